@@ -2,124 +2,63 @@ import csv
 import os
 import numpy as np
 from plotter_definitions import *
+import pandas as pd
 
 dirname = os.path.dirname(__file__)
 
-hypervolume_per_solver_per_instance = {}
-hypervolume_per_solver = {}
+metrics_codes_to_labels = {"hypervolume": "Hypervolume", "igd_plus": "IGD+", "multiplicative_epsilon": "Multiplicative Epsilon"}
 
-for solver in solvers:
-    hypervolume_per_solver_per_instance[solver] = {}
-    hypervolume_per_solver[solver] = []
+# The final values of the results store written by the metric calculators,
+# one row per run, or else the same values read from the files of each run
+if os.path.exists(os.path.join(dirname, "results.csv")):
+    df_results = pd.read_csv(os.path.join(dirname, "results.csv"))
+    df_results = df_results[df_results["snapshot"] == -1]
+else:
+    results = []
 
     for instance in instances:
-        hypervolume_per_solver_per_instance[solver][instance] = []
+        for solver in solvers:
+            for seed in seeds:
+                for code in metrics_codes_to_labels.keys():
+                    filename = os.path.join(dirname, code + "/" + instance + "_" + solver + "_" + str(seed) + ".txt")
+                    if os.path.exists(filename):
+                        with open(filename) as csv_file:
+                            for row in csv.reader(csv_file, delimiter = ","):
+                                results.append([instance, solver, seed, code, float(row[0])])
+                    else:
+                        print("File not found: " + filename)
 
-        filename = os.path.join(dirname, "hypervolume/" + instance + "_" + solver + ".txt")
-        if os.path.exists(filename):
-            with open(filename) as csv_file:
-                data = csv.reader(csv_file)
-                for row in data:
-                    hypervolume_per_solver_per_instance[solver][instance].append(float(row[0]))
-                    hypervolume_per_solver[solver].append(float(row[0]))
-                csv_file.close()
-        else:
-            print("File not found: " + filename)
+    df_results = pd.DataFrame(results, columns=["instance", "solver", "seed", "metric", "value"])
+    df_results = df_results.pivot_table(index=["instance", "solver", "seed"], columns="metric", values="value").reset_index()
 
-print("Hypervolume:")
+    for code in metrics_codes_to_labels.keys():
+        if code not in df_results:
+            df_results[code] = float("nan")
 
-for instance in instances:
-    print()
-    print(instance + ":")
-    for solver in solvers:
-        print(solver + ":")
-        print(str(np.mean(hypervolume_per_solver_per_instance[solver][instance])) + " +/- " + str(np.std(hypervolume_per_solver_per_instance[solver][instance])))
-
-print()
-print()
-print("All intances:")
-for solver in solvers:
-    print(solver + ":")
-    print(str(np.mean(hypervolume_per_solver[solver])) + " +/- " + str(np.std(hypervolume_per_solver[solver])))
-
-print()
-print()
-print()
+df_results = df_results[df_results["instance"].isin(instances) & df_results["solver"].isin(solvers) & df_results["seed"].isin(seeds)]
 
-igd_plus_per_solver_per_instance = {}
-igd_plus_per_solver = {}
+for code, label in metrics_codes_to_labels.items():
+    df_metric = df_results.dropna(subset=[code])
 
-for solver in solvers:
-    igd_plus_per_solver_per_instance[solver] = {}
-    igd_plus_per_solver[solver] = []
+    print(label + ":")
 
     for instance in instances:
-        igd_plus_per_solver_per_instance[solver][instance] = []
+        print()
+        print(instance + ":")
+        for solver in solvers:
+            values = df_metric[(df_metric["instance"] == instance) & (df_metric["solver"] == solver)][code]
+            print(solver + ":")
+            print(str(np.mean(values)) + " +/- " + str(np.std(values)))
 
-        filename = os.path.join(dirname, "igd_plus/" + instance + "_" + solver + ".txt")
-        if os.path.exists(filename):
-            with open(filename) as csv_file:
-                data = csv.reader(csv_file)
-                for row in data:
-                    igd_plus_per_solver_per_instance[solver][instance].append(float(row[0]))
-                    igd_plus_per_solver[solver].append(float(row[0]))
-                csv_file.close()
-        else:
-            print("File not found: " + filename)
-
-print("IGD+:")
-
-for instance in instances:
     print()
-    print(instance + ":")
-    for solver in solvers:
-        print(solver + ":")
-        print(str(np.mean(igd_plus_per_solver_per_instance[solver][instance])) + " +/- " + str(np.std(igd_plus_per_solver_per_instance[solver][instance])))
-
-print()
-print()
-print("All intances:")
-for solver in solvers:
-    print(solver + ":")
-    print(str(np.mean(igd_plus_per_solver[solver])) + " +/- " + str(np.std(igd_plus_per_solver[solver])))
-
-print()
-print()
-print()
-
-multiplicative_epsilon_per_solver_per_instance = {}
-multiplicative_epsilon_per_solver = {}
-
-for solver in solvers:
-    multiplicative_epsilon_per_solver_per_instance[solver] = {}
-    multiplicative_epsilon_per_solver[solver] = []
-
-    for instance in instances:
-        multiplicative_epsilon_per_solver_per_instance[solver][instance] = []
-
-        filename = os.path.join(dirname, "multiplicative_epsilon/" + instance + "_" + solver + ".txt")
-        if os.path.exists(filename):
-            with open(filename) as csv_file:
-                data = csv.reader(csv_file)
-                for row in data:
-                    multiplicative_epsilon_per_solver_per_instance[solver][instance].append(float(row[0]))
-                    multiplicative_epsilon_per_solver[solver].append(float(row[0]))
-                csv_file.close()
-        else:
-            print("File not found: " + filename)
-
-print("Multiplicative Epsilon:")
-
-for instance in instances:
     print()
-    print(instance + ":")
+    print("All intances:")
     for solver in solvers:
+        values = df_metric[df_metric["solver"] == solver][code]
         print(solver + ":")
-        print(str(np.mean(multiplicative_epsilon_per_solver_per_instance[solver][instance])) + " +/- " + str(np.std(multiplicative_epsilon_per_solver_per_instance[solver][instance])))
+        print(str(np.mean(values)) + " +/- " + str(np.std(values)))
 
-print()
-print()
-print("All intances:")
-for solver in solvers:
-    print(solver + ":")
-    print(str(np.mean(multiplicative_epsilon_per_solver[solver])) + " +/- " + str(np.std(multiplicative_epsilon_per_solver[solver])))
+    if code != "multiplicative_epsilon":
+        print()
+        print()
+        print()
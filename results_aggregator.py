@@ -8,42 +8,50 @@ dirname = os.path.dirname(__file__)
 metrics_labels = ["Hypervolume Ratio", "Modified Inverted Generational Distance", "Multiplicative Epsilon Indicator"]
 metrics_labels_to_code = {"Hypervolume Ratio": "hypervolume", "Modified Inverted Generational Distance": "igd_plus", "Multiplicative Epsilon Indicator": "multiplicative_epsilon"}
 
-metrics = []
-
-for instance in instances:
-    for i in range(len(solvers)):
-        for seed in seeds:
-            filename = os.path.join(dirname, "hypervolume/" + instance + "_" + solvers[i] + "_" + str(seed) + ".txt")
-            if os.path.exists(filename):
-                with open(filename) as csv_file:
-                    data = csv.reader(csv_file, delimiter = ",")
-                    for row in data:
-                        metrics.append(["MOFJSSP", instance, m, 2 * total_num_operations_per_instance[instance], num_jobs_per_instance[instance], num_machines_per_instance[instance], total_num_operations_per_instance[instance], solver_labels[solvers[i]], seed, metrics_labels[0], float(row[0])])
-                    csv_file.close()
-
-for instance in instances:
-    for i in range(len(solvers)):
-        for seed in seeds:
-            filename = os.path.join(dirname, "igd_plus/" + instance + "_" + solvers[i] + "_" + str(seed) + ".txt")
-            if os.path.exists(filename):
-                with open(filename) as csv_file:
-                    data = csv.reader(csv_file, delimiter = ",")
-                    for row in data:
-                        metrics.append(["MOFJSSP", instance, m, 2 * total_num_operations_per_instance[instance], num_jobs_per_instance[instance], num_machines_per_instance[instance], total_num_operations_per_instance[instance], solver_labels[solvers[i]], seed, metrics_labels[1], float(row[0])])
-                    csv_file.close()
-
-for instance in instances:
-    for i in range(len(solvers)):
-        for seed in seeds:
-            filename = os.path.join(dirname, "multiplicative_epsilon/" + instance + "_" + solvers[i] + "_" + str(seed) + ".txt")
-            if os.path.exists(filename):
-                with open(filename) as csv_file:
-                    data = csv.reader(csv_file, delimiter = ",")
-                    for row in data:
-                        metrics.append(["MOFJSSP", instance, m, 2 * total_num_operations_per_instance[instance], num_jobs_per_instance[instance], num_machines_per_instance[instance], total_num_operations_per_instance[instance], solver_labels[solvers[i]], seed, metrics_labels[2], float(row[0])])
-                    csv_file.close()
-
-df_metrics = pd.DataFrame(metrics, columns=["problem", "instance", "number of objectives", "chromosome size", "number of jobs", "number of machines", "total number of operations", "solver", "seed", "metric name", "metric value"])
+metrics_codes_to_labels = {code: label for label, code in metrics_labels_to_code.items()}
+
+# The results store written by the metric calculators, one row per run and
+# snapshot, or else the same rows read from the files of each run
+if os.path.exists(os.path.join(dirname, "results.csv")):
+    df_results = pd.read_csv(os.path.join(dirname, "results.csv"))
+else:
+    results = []
+
+    for instance in instances:
+        for solver in solvers:
+            for seed in seeds:
+                for code in metrics_codes_to_labels.keys():
+                    filename = os.path.join(dirname, code + "/" + instance + "_" + solver + "_" + str(seed) + ".txt")
+                    if os.path.exists(filename):
+                        with open(filename) as csv_file:
+                            for row in csv.reader(csv_file, delimiter = ","):
+                                results.append([instance, solver, seed, -1, 0.0, code, float(row[0])])
+
+                    filename = os.path.join(dirname, code + "_snapshots/" + instance + "_" + solver + "_" + str(seed) + ".txt")
+                    if os.path.exists(filename):
+                        with open(filename) as csv_file:
+                            for snapshot, row in enumerate(csv.reader(csv_file, delimiter = ",")):
+                                results.append([instance, solver, seed, snapshot, float(row[1]), code, float(row[2])])
+
+    df_results = pd.DataFrame(results, columns=["instance", "solver", "seed", "snapshot", "time", "metric", "value"])
+    df_results = df_results.pivot_table(index=["instance", "solver", "seed", "snapshot", "time"], columns="metric", values="value").reset_index()
+
+    for code in metrics_codes_to_labels.keys():
+        if code not in df_results:
+            df_results[code] = float("nan")
+
+df_results = df_results[df_results["instance"].isin(instances) & df_results["solver"].isin(solvers) & df_results["seed"].isin(seeds)]
+df_results = df_results.melt(id_vars=["instance", "solver", "seed", "snapshot", "time"], value_vars=list(metrics_codes_to_labels.keys()), var_name="metric name", value_name="metric value").dropna(subset=["metric value"])
+df_results["problem"] = "MOFJSSP"
+df_results["number of objectives"] = m
+df_results["chromosome size"] = df_results["instance"].map(lambda instance: 2 * total_num_operations_per_instance[instance])
+df_results["number of jobs"] = df_results["instance"].map(num_jobs_per_instance)
+df_results["number of machines"] = df_results["instance"].map(num_machines_per_instance)
+df_results["total number of operations"] = df_results["instance"].map(total_num_operations_per_instance)
+df_results["solver"] = df_results["solver"].map(solver_labels)
+df_results["metric name"] = df_results["metric name"].map(metrics_codes_to_labels)
+
+df_metrics = df_results[df_results["snapshot"] == -1][["problem", "instance", "number of objectives", "chromosome size", "number of jobs", "number of machines", "total number of operations", "solver", "seed", "metric name", "metric value"]]
 df_metrics_aux = df_metrics.drop(columns=["number of jobs", "number of machines", "total number of operations"])
 df_metrics_aux.to_csv(os.path.join(dirname, "metrics.csv"), index=False)
 
@@ -107,40 +115,5 @@ for metric in df_metrics_grouped_by_objectives['metric name'].unique():
 
     df_metric_by_objectives.to_csv(os.path.join(dirname, metrics_labels_to_code[metric] + "_by_objectives_stats.csv"), index=False)
 
-metrics_snapshots = []
-
-for instance in instances:
-    for i in range(len(solvers)):
-        for seed in seeds:
-            filename = os.path.join(dirname, "hypervolume_snapshots/" + instance + "_" + solvers[i] + "_" + str(seed) + ".txt")
-            if os.path.exists(filename):
-                with open(filename) as csv_file:
-                    data = csv.reader(csv_file, delimiter = ",")
-                    for row in data:
-                        metrics_snapshots.append(["MOFJSSP", instance, m, 2 * total_num_operations_per_instance[instance], solver_labels[solvers[i]], seed, metrics_labels[0], float(row[1]), float(row[2])])
-                    csv_file.close()
-
-for instance in instances:
-    for i in range(len(solvers)):
-        for seed in seeds:
-            filename = os.path.join(dirname, "igd_plus_snapshots/" + instance + "_" + solvers[i] + "_" + str(seed) + ".txt")
-            if os.path.exists(filename):
-                with open(filename) as csv_file:
-                    data = csv.reader(csv_file, delimiter = ",")
-                    for row in data:
-                        metrics_snapshots.append(["MOFJSSP", instance, m, 2 * total_num_operations_per_instance[instance], solver_labels[solvers[i]], seed, metrics_labels[1], float(row[1]), float(row[2])])
-                    csv_file.close()
-
-for instance in instances:
-    for i in range(len(solvers)):
-        for seed in seeds:
-            filename = os.path.join(dirname, "multiplicative_epsilon_snapshots/" + instance + "_" + solvers[i] + "_" + str(seed) + ".txt")
-            if os.path.exists(filename):
-                with open(filename) as csv_file:
-                    data = csv.reader(csv_file, delimiter = ",")
-                    for row in data:
-                        metrics_snapshots.append(["MOFJSSP", instance, m, 2 * total_num_operations_per_instance[instance], solver_labels[solvers[i]], seed, metrics_labels[2], float(row[1]), float(row[2])])
-                    csv_file.close()
-
-df_metrics_snapshots = pd.DataFrame(metrics_snapshots, columns=["problem", "instance", "number of objectives", "chromosome size", "solver", "seed", "metric name", "snapshot time", "metric value"])
+df_metrics_snapshots = df_results[df_results["snapshot"] >= 0].rename(columns={"time": "snapshot time"})[["problem", "instance", "number of objectives", "chromosome size", "solver", "seed", "metric name", "snapshot time", "metric value"]]
 df_metrics_snapshots.to_csv(os.path.join(dirname, "metrics_snapshots.csv"), index=False)
@@ -30,376 +30,142 @@ mkdir -p ${path}/multiplicative_epsilon
 mkdir -p ${path}/multiplicative_epsilon_snapshots
 mkdir -p ${path}/metrics
 mkdir -p ${path}/metrics_snapshots
+mkdir -p ${path}/runs
+rm -f ${path}/results.csv
 
-commands=()
-
-for ((i=0;i<num_processes;i++))
-do
-    commands[$i]="("
-done
-
-i=0
+manifest=${path}/experiment.txt
 
+echo "output-directory ${path}" > ${manifest}
 for instance in ${instances[@]}
 do
-    for solver in ${solvers[@]}
-    do
-        for seed in ${seeds[@]}
-        do
-
-            command="${path}/bin/exec/${solver}_solver_exec "
-            command+="--instance ${path}/instances/${instance}.txt "
-            command+="--seed ${seed} "
-            command+="--time-limit ${time_limit} "
-            command+="--max-num-solutions ${max_num_solutions} "
-            command+="--max-num-snapshots ${max_num_snapshots} "
-            command+="--statistics ${path}/statistics/${instance}_${solver}_${seed}.txt "
-            # command+="--solutions ${path}/solutions/${instance}_${solver}_${seed}_ "
-            command+="--pareto ${path}/pareto/${instance}_${solver}_${seed}.txt "
-            command+="--best-solutions-snapshots ${path}/best_solutions_snapshots/${instance}_${solver}_${seed}_ "
-            command+="--num-non-dominated-snapshots ${path}/num_non_dominated_snapshots/${instance}_${solver}_${seed}.txt "
-            command+="--num-fronts-snapshots ${path}/num_fronts_snapshots/${instance}_${solver}_${seed}.txt "
-            command+="--populations-snapshots ${path}/populations_snapshots/${instance}_${solver}_${seed}_ "
-            if [ $solver = "nspso" ]
-            then
-                command+="--memory "
-            fi
-            if [ $solver = "moead" ]
-            then
-                command+="--preserve-diversity "
-            fi
-            if [ $solver = "mhaco" ]
-            then
-                command+="--memory "
-            fi
-            if [ $solver = "nsbrkga" ]
-            then
-                command+="--num-elites-snapshots ${path}/num_elites_snapshots/${instance}_${solver}_${seed}.txt "
-            fi
-            if [ $i -lt $num_processes ]
-            then
-                commands[$i]+="$command"
-            else
-                commands[$((i%num_processes))]+=" && $command"
-            fi
-            i=$((i+1))
-        done
-    done
-done
-
-for ((i=0;i<num_processes;i++))
-do
-    commands[$i]+=") &> ${path}/log_${i}.txt"
-done
-
-final_command=""
-
-for ((i=0;i<num_processes;i++))
-do
-    command=${commands[$i]}
-    final_command+="$command & "
+    echo "instance ${path}/instances/${instance}.txt" >> ${manifest}
 done
+echo "solver ${solvers[@]}" >> ${manifest}
+echo "seed ${seeds[@]}" >> ${manifest}
+echo "time-limit ${time_limit}" >> ${manifest}
+echo "max-num-solutions ${max_num_solutions}" >> ${manifest}
+echo "max-num-snapshots ${max_num_snapshots}" >> ${manifest}
+echo "nspso.memory" >> ${manifest}
+echo "moead.preserve-diversity" >> ${manifest}
+echo "mhaco.memory" >> ${manifest}
 
-eval $final_command
-
-wait
+${path}/bin/exec/experiment_runner_exec \
+    --manifest ${manifest} \
+    --num-threads ${num_processes} &> ${path}/log_0.txt
 
 solvers=(nsga2 nspso moead mhaco ihs nsbrkga)
 
-commands=()
-
-for ((i=0;i<num_processes;i++))
-do
-    commands[$i]="("
-done
-
-i=0
-
+# The runs of each instance, with their files, read by the calculators
 for instance in ${instances[@]}
 do
-    command="${path}/bin/exec/reference_pareto_front_calculator_exec "
-    command+="--instance ${path}/instances/${instance}.txt "
-    command+="--max-num-solutions ${max_ref_solutions} "
-    j=0;
+    runs=${path}/runs/${instance}.csv
+    echo "solver,seed,pareto,best-solutions-snapshots,hypervolume,hypervolume-snapshots,igd-plus,igd-plus-snapshots,multiplicative-epsilon,multiplicative-epsilon-snapshots" > ${runs}
     for solver in ${solvers[@]}
     do
         for seed in ${seeds[@]}
         do
-            command+="--pareto-${j} ${path}/pareto/${instance}_${solver}_${seed}.txt "
-            command+="--best-solutions-snapshots-${j} ${path}/best_solutions_snapshots/${instance}_${solver}_${seed}_ "
-            command+="--reference-pareto ${path}/pareto/${instance}.txt "
-            j=$((j+1))
+            run=${instance}_${solver}_${seed}
+            echo "${solver},${seed},${path}/pareto/${run}.txt,${path}/best_solutions_snapshots/${run}_,${path}/hypervolume/${run}.txt,${path}/hypervolume_snapshots/${run}.txt,${path}/igd_plus/${run}.txt,${path}/igd_plus_snapshots/${run}.txt,${path}/multiplicative_epsilon/${run}.txt,${path}/multiplicative_epsilon_snapshots/${run}.txt" >> ${runs}
         done
     done
-    if [ $i -lt $num_processes ]
-    then
-        commands[$i]+="$command"
-    else
-        commands[$((i%num_processes))]+=" && $command"
-    fi
-    i=$((i+1))
 done
 
-for ((i=0;i<num_processes;i++))
-do
-    commands[$i]+=") &>> ${path}/log_${i}.txt"
-done
-
-final_command=""
-
-for ((i=0;i<num_processes;i++))
+# Each calculator processes the runs of an instance in parallel
+for instance in ${instances[@]}
 do
-    command=${commands[$i]}
-    final_command+="$command & "
+    ${path}/bin/exec/reference_pareto_front_calculator_exec \
+        --instance ${path}/instances/${instance}.txt \
+        --runs ${path}/runs/${instance}.csv \
+        --reference-pareto ${path}/pareto/${instance}.txt \
+        --max-num-solutions ${max_ref_solutions} \
+        --num-threads ${num_processes} &>> ${path}/log_0.txt
 done
 
-eval $final_command
-
-wait
-
-commands=()
-
-for ((i=0;i<num_processes;i++))
+for calculator in hypervolume_calculator_exec \
+                  modified_generational_distance_calculator_exec \
+                  multiplicative_epsilon_calculator_exec
 do
-    commands[$i]="("
-done
-
-i=0
-
-for instance in ${instances[@]}
-do
-    command="${path}/bin/exec/hypervolume_calculator_exec "
-    command+="--instance ${path}/instances/${instance}.txt "
-    command+="--reference-pareto ${path}/pareto/${instance}.txt "
-    j=0;
-    for solver in ${solvers[@]}
+    for instance in ${instances[@]}
     do
-        for seed in ${seeds[@]}
-        do
-            command+="--pareto-${j} ${path}/pareto/${instance}_${solver}_${seed}.txt "
-            command+="--best-solutions-snapshots-${j} ${path}/best_solutions_snapshots/${instance}_${solver}_${seed}_ "
-            command+="--hypervolume-${j} ${path}/hypervolume/${instance}_${solver}_${seed}.txt "
-            command+="--hypervolume-snapshots-${j} ${path}/hypervolume_snapshots/${instance}_${solver}_${seed}.txt "
-            j=$((j+1))
-        done
+        ${path}/bin/exec/${calculator} \
+            --instance ${path}/instances/${instance}.txt \
+            --runs ${path}/runs/${instance}.csv \
+            --reference-pareto ${path}/pareto/${instance}.txt \
+            --results ${path}/results.csv \
+            --num-threads ${num_processes} &>> ${path}/log_0.txt
     done
-    if [ $i -lt $num_processes ]
-    then
-        commands[$i]+="$command"
-    else
-        commands[$((i%num_processes))]+=" && $command"
-    fi
-    i=$((i+1))
 done
 
-for ((i=0;i<num_processes;i++))
-do
-    commands[$i]+=") &>> ${path}/log_${i}.txt"
-done
-
-final_command=""
-
-for ((i=0;i<num_processes;i++))
-do
-    command=${commands[$i]}
-    final_command+="$command & "
-done
-
-eval $final_command
-
-wait
-
-commands=()
-
-for ((i=0;i<num_processes;i++))
-do
-    commands[$i]="("
-done
-
-i=0
-
+# The runs of each instance and solver, with their files, read by the
+# aggregator
 for instance in ${instances[@]}
 do
-    command="${path}/bin/exec/modified_generational_distance_calculator_exec "
-    command+="--instance ${path}/instances/${instance}.txt "
-    command+="--reference-pareto ${path}/pareto/${instance}.txt "
-    j=0;
     for solver in ${solvers[@]}
     do
+        runs=${path}/runs/${instance}_${solver}.csv
+        echo "statistics,pareto,hypervolume,hypervolume-snapshots,igd-plus,igd-plus-snapshots,multiplicative-epsilon,multiplicative-epsilon-snapshots,best-solutions-snapshots,num-non-dominated-snapshots,populations-snapshots,num-fronts-snapshots,num-elites-snapshots" > ${runs}
         for seed in ${seeds[@]}
         do
-            command+="--pareto-${j} ${path}/pareto/${instance}_${solver}_${seed}.txt "
-            command+="--best-solutions-snapshots-${j} ${path}/best_solutions_snapshots/${instance}_${solver}_${seed}_ "
-            command+="--igd-plus-${j} ${path}/igd_plus/${instance}_${solver}_${seed}.txt "
-            command+="--igd-plus-snapshots-${j} ${path}/igd_plus_snapshots/${instance}_${solver}_${seed}.txt "
-            j=$((j+1))
+            run=${instance}_${solver}_${seed}
+            num_elites_snapshots=""
+            if [ $solver = "nsbrkga" ]
+            then
+                num_elites_snapshots=${path}/num_elites_snapshots/${run}.txt
+            fi
+            echo "${path}/statistics/${run}.txt,${path}/pareto/${run}.txt,${path}/hypervolume/${run}.txt,${path}/hypervolume_snapshots/${run}.txt,${path}/igd_plus/${run}.txt,${path}/igd_plus_snapshots/${run}.txt,${path}/multiplicative_epsilon/${run}.txt,${path}/multiplicative_epsilon_snapshots/${run}.txt,${path}/best_solutions_snapshots/${run}_,${path}/num_non_dominated_snapshots/${run}.txt,${path}/populations_snapshots/${run}_,${path}/num_fronts_snapshots/${run}.txt,${num_elites_snapshots}" >> ${runs}
         done
     done
-    if [ $i -lt $num_processes ]
-    then
-        commands[$i]+="$command"
-    else
-        commands[$((i%num_processes))]+=" && $command"
-    fi
-    i=$((i+1))
-done
-
-for ((i=0;i<num_processes;i++))
-do
-    commands[$i]+=") &>> ${path}/log_${i}.txt"
-done
-
-final_command=""
-
-for ((i=0;i<num_processes;i++))
-do
-    command=${commands[$i]}
-    final_command+="$command & "
 done
 
-eval $final_command
-
-wait
-
-commands=()
-
-for ((i=0;i<num_processes;i++))
-do
-    commands[$i]="("
-done
-
-i=0
-
+# The runs of each instance and solver are aggregated by one of at most
+# num_processes aggregators running at a time
 for instance in ${instances[@]}
 do
-    command="${path}/bin/exec/multiplicative_epsilon_calculator_exec "
-    command+="--instance ${path}/instances/${instance}.txt "
-    command+="--reference-pareto ${path}/pareto/${instance}.txt "
-    j=0;
     for solver in ${solvers[@]}
     do
-        for seed in ${seeds[@]}
+        while [ $(jobs -rp | wc -l) -ge ${num_processes} ]
         do
-            command+="--pareto-${j} ${path}/pareto/${instance}_${solver}_${seed}.txt "
-            command+="--best-solutions-snapshots-${j} ${path}/best_solutions_snapshots/${instance}_${solver}_${seed}_ "
-            command+="--multiplicative-epsilon-${j} ${path}/multiplicative_epsilon/${instance}_${solver}_${seed}.txt "
-            command+="--multiplicative-epsilon-snapshots-${j} ${path}/multiplicative_epsilon_snapshots/${instance}_${solver}_${seed}.txt "
-            j=$((j+1))
+            wait -n
         done
-    done
-    if [ $i -lt $num_processes ]
-    then
-        commands[$i]+="$command"
-    else
-        commands[$((i%num_processes))]+=" && $command"
-    fi
-    i=$((i+1))
-done
-
-for ((i=0;i<num_processes;i++))
-do
-    commands[$i]+=") &>> ${path}/log_${i}.txt"
-done
-
-final_command=""
 
-for ((i=0;i<num_processes;i++))
-do
-    command=${commands[$i]}
-    final_command+="$command & "
-done
-
-eval $final_command
-
-wait
-
-commands=()
-
-for ((i=0;i<num_processes;i++))
-do
-    commands[$i]="("
-done
-
-i=0
-
-for instance in ${instances[@]}
-do
-    for solver in ${solvers[@]}
-    do
-        command="${path}/bin/exec/results_aggregator_exec "
-        command+="--hypervolumes ${path}/hypervolume/${instance}_${solver}.txt "
-        command+="--hypervolume-statistics ${path}/hypervolume/${instance}_${solver}_stats.txt "
-        command+="--igd-pluses ${path}/igd_plus/${instance}_${solver}.txt "
-        command+="--igd-pluses-statistics ${path}/igd_plus/${instance}_${solver}_stats.txt "
-        command+="--multiplicative-epsilons ${path}/multiplicative_epsilon/${instance}_${solver}.txt "
-        command+="--multiplicative-epsilons-statistics ${path}/multiplicative_epsilon/${instance}_${solver}_stats.txt "
-        command+="--statistics-best ${path}/statistics/${instance}_${solver}_best.txt "
-        command+="--statistics-median ${path}/statistics/${instance}_${solver}_median.txt "
-        command+="--pareto-best ${path}/pareto/${instance}_${solver}_best.txt "
-        command+="--pareto-median ${path}/pareto/${instance}_${solver}_median.txt "
-        command+="--hypervolume-snapshots-best ${path}/hypervolume_snapshots/${instance}_${solver}_best.txt "
-        command+="--hypervolume-snapshots-median ${path}/hypervolume_snapshots/${instance}_${solver}_median.txt "
-        command+="--best-solutions-snapshots-best ${path}/best_solutions_snapshots/${instance}_${solver}_best_ "
-        command+="--best-solutions-snapshots-median ${path}/best_solutions_snapshots/${instance}_${solver}_median_ "
-        command+="--num-non-dominated-snapshots-best ${path}/num_non_dominated_snapshots/${instance}_${solver}_best.txt "
-        command+="--num-non-dominated-snapshots-median ${path}/num_non_dominated_snapshots/${instance}_${solver}_median.txt "
-        command+="--populations-snapshots-best ${path}/populations_snapshots/${instance}_${solver}_best_ "
-        command+="--populations-snapshots-median ${path}/populations_snapshots/${instance}_${solver}_median_ "
-        command+="--num-fronts-snapshots-best ${path}/num_fronts_snapshots/${instance}_${solver}_best.txt "
-        command+="--num-fronts-snapshots-median ${path}/num_fronts_snapshots/${instance}_${solver}_median.txt "
+        num_elites_snapshots=()
         if [ $solver = "nsbrkga" ]
         then
-            command+="--num-elites-snapshots-best ${path}/num_elites_snapshots/${instance}_${solver}_best.txt "
-            command+="--num-elites-snapshots-median ${path}/num_elites_snapshots/${instance}_${solver}_median.txt "
+            num_elites_snapshots=(--num-elites-snapshots-best ${path}/num_elites_snapshots/${instance}_${solver}_best.txt
+                                  --num-elites-snapshots-median ${path}/num_elites_snapshots/${instance}_${solver}_median.txt)
         fi
-        j=0;
-        for seed in ${seeds[@]}
-        do
-            command+="--statistics-${j} ${path}/statistics/${instance}_${solver}_${seed}.txt "
-            command+="--pareto-${j} ${path}/pareto/${instance}_${solver}_${seed}.txt "
-            command+="--hypervolume-${j} ${path}/hypervolume/${instance}_${solver}_${seed}.txt "
-            command+="--hypervolume-snapshots-${j} ${path}/hypervolume_snapshots/${instance}_${solver}_${seed}.txt "
-            command+="--igd-plus-${j} ${path}/igd_plus/${instance}_${solver}_${seed}.txt "
-            command+="--igd-plus-snapshots-${j} ${path}/igd_plus_snapshots/${instance}_${solver}_${seed}.txt "
-            command+="--multiplicative-epsilon-${j} ${path}/multiplicative_epsilon/${instance}_${solver}_${seed}.txt "
-            command+="--multiplicative-epsilon-snapshots-${j} ${path}/multiplicative_epsilon_snapshots/${instance}_${solver}_${seed}.txt "
-            command+="--best-solutions-snapshots-${j} ${path}/best_solutions_snapshots/${instance}_${solver}_${seed}_ "
-            command+="--num-non-dominated-snapshots-${j} ${path}/num_non_dominated_snapshots/${instance}_${solver}_${seed}.txt "
-            command+="--populations-snapshots-${j} ${path}/populations_snapshots/${instance}_${solver}_${seed}_ "
-            command+="--num-fronts-snapshots-${j} ${path}/num_fronts_snapshots/${instance}_${solver}_${seed}.txt "
-            if [ $solver = "nsbrkga" ]
-            then
-                command+="--num-elites-snapshots-${j} ${path}/num_elites_snapshots/${instance}_${solver}_${seed}.txt "
-            fi
-            j=$((j+1))
-        done
-        if [ $i -lt $num_processes ]
-        then
-            commands[$i]+="$command"
-        else
-            commands[$((i%num_processes))]+=" && $command"
-        fi
-        i=$((i+1))
-    done
-done
-
-for ((i=0;i<num_processes;i++))
-do
-    commands[$i]+=") &>> ${path}/log_${i}.txt"
-done
 
-final_command=""
-
-for ((i=0;i<num_processes;i++))
-do 
-    command=${commands[$i]}
-    final_command+="$command & "
+        ${path}/bin/exec/results_aggregator_exec \
+            --runs ${path}/runs/${instance}_${solver}.csv \
+            --hypervolumes ${path}/hypervolume/${instance}_${solver}.txt \
+            --hypervolume-statistics ${path}/hypervolume/${instance}_${solver}_stats.txt \
+            --igd-pluses ${path}/igd_plus/${instance}_${solver}.txt \
+            --igd-plus-statistics ${path}/igd_plus/${instance}_${solver}_stats.txt \
+            --multiplicative-epsilons ${path}/multiplicative_epsilon/${instance}_${solver}.txt \
+            --multiplicative-epsilon-statistics ${path}/multiplicative_epsilon/${instance}_${solver}_stats.txt \
+            --statistics-best ${path}/statistics/${instance}_${solver}_best.txt \
+            --statistics-median ${path}/statistics/${instance}_${solver}_median.txt \
+            --pareto-best ${path}/pareto/${instance}_${solver}_best.txt \
+            --pareto-median ${path}/pareto/${instance}_${solver}_median.txt \
+            --hypervolume-snapshots-best ${path}/hypervolume_snapshots/${instance}_${solver}_best.txt \
+            --hypervolume-snapshots-median ${path}/hypervolume_snapshots/${instance}_${solver}_median.txt \
+            --best-solutions-snapshots-best ${path}/best_solutions_snapshots/${instance}_${solver}_best_ \
+            --best-solutions-snapshots-median ${path}/best_solutions_snapshots/${instance}_${solver}_median_ \
+            --num-non-dominated-snapshots-best ${path}/num_non_dominated_snapshots/${instance}_${solver}_best.txt \
+            --num-non-dominated-snapshots-median ${path}/num_non_dominated_snapshots/${instance}_${solver}_median.txt \
+            --populations-snapshots-best ${path}/populations_snapshots/${instance}_${solver}_best_ \
+            --populations-snapshots-median ${path}/populations_snapshots/${instance}_${solver}_median_ \
+            --num-fronts-snapshots-best ${path}/num_fronts_snapshots/${instance}_${solver}_best.txt \
+            --num-fronts-snapshots-median ${path}/num_fronts_snapshots/${instance}_${solver}_median.txt \
+            "${num_elites_snapshots[@]}" &>> ${path}/log_0.txt &
+    done
 done
 
-eval $final_command
-
 wait
 
+${path}/bin/exec/results_aggregator_exec \
+    --results ${path}/results.csv \
+    --results-statistics ${path}/results_stats.csv &>> ${path}/log_0.txt
 python3 ${path}/plotter_hypervolume.py &
 python3 ${path}/plotter_hypervolume_snapshots.py &
 python3 ${path}/plotter_igd_plus.py &
@@ -0,0 +1,333 @@
+#include "solver/archive.hpp"
+#include "solver/hypervolume_contributions.hpp"
+#include "solver/indicators.hpp"
+#include "solver/nsbrkga/decoder.hpp"
+#include "utils/argument_parser.hpp"
+#include "utils/performance_counters.hpp"
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+
+/********************************************************************
+ * The measures of a kernel, per evaluation.
+ ********************************************************************/
+struct Measure {
+    std::string kernel;
+    unsigned num_evaluations;
+    double time;
+    std::array<double, Performance_Counters::NUM_EVENTS> counts;
+};
+
+// Prevents the results of the kernels from being optimized away
+static volatile double sink = 0.0;
+
+static Measure measure(const std::string & kernel,
+                       unsigned num_evaluations,
+                       Performance_Counters * counters,
+                       const std::function<double(unsigned)> & evaluate) {
+    Measure result{kernel, num_evaluations, 0.0, {}};
+    double sum = 0.0;
+
+    result.counts.fill(-1.0);
+
+    if (counters != nullptr) {
+        counters->start();
+    }
+
+    const auto start_time = std::chrono::steady_clock::now();
+
+    for (unsigned i = 0; i < num_evaluations; i++) {
+        sum += evaluate(i);
+    }
+
+    const auto end_time = std::chrono::steady_clock::now();
+
+    if (counters != nullptr) {
+        counters->stop();
+
+        for (unsigned event = 0;
+             event < Performance_Counters::NUM_EVENTS;
+             event++) {
+            const double count =
+                counters->count(Performance_Counters::Event(event));
+
+            if (count >= 0.0) {
+                result.counts[event] = count / num_evaluations;
+            }
+        }
+    }
+
+    result.time = std::chrono::duration<double>(end_time - start_time).count() /
+                  num_evaluations;
+    sink = sink + sum;
+
+    return result;
+}
+
+// A random front of mutually non-dominated points, between the lower
+// bound (0) and the primal bound of each objective
+static std::vector<std::vector<double>> random_front(
+        const mofjssp::Instance & instance,
+        unsigned size,
+        std::mt19937 & rng) {
+    std::uniform_real_distribution<double> distribution(0.1, 1.0);
+    std::vector<std::vector<double>> front(size,
+            std::vector<double>(instance.num_objectives));
+
+    for (auto & point : front) {
+        double norm = 0.0;
+
+        for (double & value : point) {
+            value = distribution(rng);
+            norm += value * value;
+        }
+
+        for (unsigned j = 0; j < point.size(); j++) {
+            point[j] = instance.primal_bound[j] *
+                       (1.0 - 0.5 * point[j] / std::sqrt(norm));
+        }
+    }
+
+    return front;
+}
+
+static void write_measures(std::ostream & os,
+                           const std::vector<Measure> & measures) {
+    os << "kernel,num_evaluations,time";
+
+    for (unsigned event = 0; event < Performance_Counters::NUM_EVENTS; event++) {
+        os << "," << Performance_Counters::name(Performance_Counters::Event(event));
+    }
+
+    os << ",ipc" << std::endl;
+
+    for (const Measure & measure : measures) {
+        const double cycles = measure.counts[Performance_Counters::CYCLES],
+                     instructions =
+                         measure.counts[Performance_Counters::INSTRUCTIONS];
+
+        os << measure.kernel << "," << measure.num_evaluations << ","
+           << measure.time;
+
+        for (double count : measure.counts) {
+            os << ",";
+
+            if (count >= 0.0) {
+                os << count;
+            } else {
+                os << "NA";
+            }
+        }
+
+        os << ",";
+
+        if (cycles > 0.0 && instructions >= 0.0) {
+            os << instructions / cycles;
+        } else {
+            os << "NA";
+        }
+
+        os << std::endl;
+    }
+}
+
+int main(int argc, char * argv[]) {
+    Argument_Parser arg_parser(argc, argv);
+
+    if(arg_parser.option_exists("--instance")) {
+        const auto instance =
+            mofjssp::Instance::load(arg_parser.option_value("--instance"));
+        unsigned seed = 2351389233, num_evaluations = 1000, front_size = 100;
+
+        if(arg_parser.option_exists("--seed")) {
+            seed = std::stoul(arg_parser.option_value("--seed"));
+        }
+
+        if(arg_parser.option_exists("--num-evaluations")) {
+            num_evaluations =
+                std::stoul(arg_parser.option_value("--num-evaluations"));
+        }
+
+        if(arg_parser.option_exists("--front-size")) {
+            front_size = std::stoul(arg_parser.option_value("--front-size"));
+        }
+
+        if(num_evaluations == 0 || front_size == 0) {
+            throw std::runtime_error(
+                    "The number of evaluations and the front size must be "
+                    "positive.");
+        }
+
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> distribution(0.0, 1.0);
+        std::unique_ptr<Performance_Counters> counters = nullptr;
+
+        if(arg_parser.option_exists("--performance-counters")) {
+            counters = std::make_unique<Performance_Counters>();
+
+            if(!counters->is_available()) {
+                std::cerr << "Performance counters unavailable; only the "
+                          << "time is measured." << std::endl;
+                counters = nullptr;
+            }
+        }
+
+        std::vector<NSBRKGA::Chromosome> chromosomes(num_evaluations,
+                NSBRKGA::Chromosome(2 * instance->total_num_operations));
+
+        for(auto & chromosome : chromosomes) {
+            for(double & allele : chromosome) {
+                allele = distribution(rng);
+            }
+        }
+
+        std::vector<Measure> measures;
+
+        {
+            mofjssp::Decoder decoder(*instance, 1);
+
+            measures.push_back(measure("decode", num_evaluations,
+                        counters.get(), [&](unsigned i) {
+                return decoder.decode(chromosomes[i], false).front();
+            }));
+        }
+
+        {
+            std::vector<mofjssp::Solution> solutions;
+
+            solutions.reserve(num_evaluations);
+
+            for(const auto & chromosome : chromosomes) {
+                solutions.emplace_back(*instance, chromosome);
+            }
+
+            measures.push_back(measure("compute_value", num_evaluations,
+                        counters.get(), [&](unsigned i) {
+                solutions[i].compute_value();
+                return solutions[i].value[0];
+            }));
+        }
+
+        {
+            // One individual at a time, into a growing archive
+            const auto points = random_front(*instance, num_evaluations, rng);
+            mofjssp::Archive::Front best_individuals;
+
+            measures.push_back(measure("archive_update", num_evaluations,
+                        counters.get(), [&](unsigned i) {
+                return double(mofjssp::Archive::update(
+                            best_individuals,
+                            {std::make_pair(points[i], std::vector<double>())},
+                            instance->senses));
+            }));
+        }
+
+        {
+            // One individual at a time, into an archive truncated to the
+            // front size
+            const auto initial_points = random_front(*instance, front_size, rng),
+                       points = random_front(*instance, num_evaluations, rng);
+            mofjssp::Archive::Front initial_individuals, new_individuals;
+
+            for(const auto & point : initial_points) {
+                new_individuals.emplace_back(point, std::vector<double>());
+            }
+
+            mofjssp::Archive::update(initial_individuals, new_individuals,
+                                     instance->senses);
+
+            mofjssp::Archive::Front best_individuals(initial_individuals);
+
+            measures.push_back(measure("crowding_truncation", num_evaluations,
+                        counters.get(), [&](unsigned i) {
+                mofjssp::Archive::update(
+                        best_individuals,
+                        {std::make_pair(points[i], std::vector<double>())},
+                        instance->senses);
+                return double(mofjssp::Archive::truncate(best_individuals,
+                                                         front_size));
+            }));
+
+            mofjssp::Hypervolume_Contributions contributions(
+                    instance->senses, instance->primal_bound);
+
+            best_individuals = initial_individuals;
+            contributions.synchronize(best_individuals);
+
+            measures.push_back(measure("hypervolume_truncation",
+                        num_evaluations, counters.get(), [&](unsigned i) {
+                mofjssp::Archive::update(
+                        best_individuals,
+                        {std::make_pair(points[i], std::vector<double>())},
+                        instance->senses);
+                return double(contributions.truncate(best_individuals,
+                                                     front_size));
+            }));
+        }
+
+        {
+            const auto reference_front =
+                random_front(*instance, front_size, rng);
+            std::vector<std::vector<std::vector<double>>> fronts;
+            std::vector<double> reference_point(instance->primal_bound);
+
+            for(unsigned i = 0; i < num_evaluations; i++) {
+                fronts.push_back(random_front(*instance, front_size, rng));
+            }
+
+            measures.push_back(measure("hypervolume", num_evaluations,
+                        counters.get(), [&](unsigned i) {
+                return mofjssp::Indicators::hypervolume(instance->senses,
+                                                        reference_point,
+                                                        fronts[i]);
+            }));
+
+            measures.push_back(measure("multiplicative_epsilon",
+                        num_evaluations, counters.get(), [&](unsigned i) {
+                return mofjssp::Indicators::multiplicative_epsilon(
+                        instance->senses, reference_front, fronts[i]);
+            }));
+
+            measures.push_back(measure("igd_plus", num_evaluations,
+                        counters.get(), [&](unsigned i) {
+                return mofjssp::Indicators::
+                    modified_inverted_generational_distance(
+                            instance->senses, reference_front, fronts[i]);
+            }));
+        }
+
+        if(arg_parser.option_exists("--benchmark")) {
+            std::ofstream ofs;
+            ofs.open(arg_parser.option_value("--benchmark"));
+
+            if(ofs.is_open()) {
+                write_measures(ofs, measures);
+
+                if(ofs.eof() || ofs.fail() || ofs.bad()) {
+                    throw std::runtime_error("Error writing file " +
+                            arg_parser.option_value("--benchmark") + ".");
+                }
+
+                ofs.close();
+            } else {
+                throw std::runtime_error(
+                        "File " + arg_parser.option_value("--benchmark") +
+                        " not created.");
+            }
+        } else {
+            write_measures(std::cout, measures);
+        }
+    } else {
+        std::cerr << "./benchmark_exec "
+                  << "--instance <instance_filename> "
+                  << "--seed <seed> "
+                  << "--num-evaluations <num_evaluations> "
+                  << "--front-size <front_size> "
+                  << "--performance-counters "
+                  << "--benchmark <benchmark_filename> "
+                  << std::endl;
+    }
+
+    return 0;
+}
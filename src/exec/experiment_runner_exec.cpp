@@ -0,0 +1,666 @@
+#include "utils/argument_parser.hpp"
+#include "utils/thread_pool.hpp"
+#include "solver/nsga2/nsga2_solver.hpp"
+#include "solver/nspso/nspso_solver.hpp"
+#include "solver/moead/moead_solver.hpp"
+#include "solver/mhaco/mhaco_solver.hpp"
+#include "solver/ihs/ihs_solver.hpp"
+#include "solver/nsbrkga/nsbrkga_solver.hpp"
+#include <filesystem>
+
+/*********************************************************************
+ * An experiment, described by a manifest with one entry per line:
+ *
+ *   output-directory <directory>
+ *   instance <instance_filename> [<instance_filename> ...]
+ *   solver <solver> [<solver> ...]
+ *   seed <seed> [<seed> ...]
+ *   time-limit <time_limit>
+ *   iterations-limit <iterations_limit>
+ *   max-num-solutions <max_num_solutions>
+ *   max-num-snapshots <max_num_snapshots>
+ *   decode-cache-size <decode_cache_size>
+ *   local-search
+ *   local-search-interval <local_search_interval>
+ *   local-search-sample-size <local_search_sample_size>
+ *   active-schedule
+ *   key-precision <double|float|fixed16>
+ *   hypervolume-targets <ratio> [<ratio> ...]
+ *   truncation <crowding|hypervolume>
+ *   shared-archive
+ *   <solver>.<parameter> [<value>]
+ *
+ * where <solver>.<parameter> sets a parameter of a solver with the
+ * same name and value of the corresponding solver exec option (e.g.,
+ * "nspso.memory" or "nsbrkga.pr-interval 500"). With shared-archive,
+ * the runs of each instance also publish their individuals, as they
+ * find them, to an archive of the instance, whose front is written
+ * to shared_pareto/<instance>.txt. Empty lines and lines starting
+ * with '#' are ignored.
+ *********************************************************************/
+struct Experiment {
+    std::string output_directory = ".";
+    std::vector<std::string> instance_filenames;
+    std::vector<std::string> solvers;
+    std::vector<unsigned> seeds;
+    double time_limit = std::numeric_limits<double>::max();
+    unsigned iterations_limit = std::numeric_limits<unsigned>::max();
+    unsigned max_num_solutions = std::numeric_limits<unsigned>::max();
+    unsigned max_num_snapshots = 0;
+    unsigned decode_cache_size = 0;
+    bool local_search = false;
+    unsigned local_search_interval = 0;
+    unsigned local_search_sample_size = 16;
+    bool active_schedule = false;
+    mofjssp::Key_Precision key_precision = mofjssp::Key_Precision::DOUBLE;
+    std::vector<double> hypervolume_targets;
+    mofjssp::Truncation truncation = mofjssp::Truncation::CROWDING_DISTANCE;
+    bool shared_archive = false;
+    std::map<std::string, std::vector<std::pair<std::string, std::string>>>
+        parameters;
+};
+
+static Experiment read_experiment(const std::string & filename) {
+    Experiment experiment;
+    std::ifstream ifs;
+
+    ifs.open(filename);
+
+    if(!ifs.is_open()) {
+        throw std::runtime_error("File " + filename + " not found.");
+    }
+
+    for(std::string line; std::getline(ifs, line);) {
+        std::istringstream iss(line);
+        std::string key, value;
+
+        if(!(iss >> key) || key.front() == '#') {
+            continue;
+        }
+
+        if(key == "output-directory") {
+            iss >> experiment.output_directory;
+        } else if(key == "instance") {
+            while(iss >> value) {
+                experiment.instance_filenames.push_back(value);
+            }
+        } else if(key == "solver") {
+            while(iss >> value) {
+                experiment.solvers.push_back(value);
+            }
+        } else if(key == "seed") {
+            while(iss >> value) {
+                experiment.seeds.push_back(std::stoul(value));
+            }
+        } else if(key == "time-limit") {
+            iss >> value;
+            experiment.time_limit = std::stod(value);
+        } else if(key == "iterations-limit") {
+            iss >> value;
+            experiment.iterations_limit = std::stoul(value);
+        } else if(key == "max-num-solutions") {
+            iss >> value;
+            experiment.max_num_solutions = std::stoul(value);
+        } else if(key == "max-num-snapshots") {
+            iss >> value;
+            experiment.max_num_snapshots = std::stoul(value);
+        } else if(key == "decode-cache-size") {
+            iss >> value;
+            experiment.decode_cache_size = std::stoul(value);
+        } else if(key == "local-search") {
+            experiment.local_search = true;
+        } else if(key == "local-search-interval") {
+            iss >> value;
+            experiment.local_search_interval = std::stoul(value);
+        } else if(key == "local-search-sample-size") {
+            iss >> value;
+            experiment.local_search_sample_size = std::stoul(value);
+        } else if(key == "active-schedule") {
+            experiment.active_schedule = true;
+        } else if(key == "key-precision") {
+            iss >> value;
+            experiment.key_precision = mofjssp::parse_key_precision(value);
+        } else if(key == "hypervolume-targets") {
+            while(iss >> value) {
+                experiment.hypervolume_targets.push_back(std::stod(value));
+            }
+        } else if(key == "truncation") {
+            iss >> value;
+            experiment.truncation = mofjssp::parse_truncation(value);
+        } else if(key == "shared-archive") {
+            experiment.shared_archive = true;
+        } else if(key.find('.') != std::string::npos) {
+            value.clear();
+            iss >> value;
+            experiment.parameters[key.substr(0, key.find('.'))].push_back(
+                    std::make_pair(key.substr(key.find('.') + 1), value));
+        } else {
+            throw std::runtime_error("Unknown entry " + key + " in file " +
+                                     filename + ".");
+        }
+    }
+
+    ifs.close();
+
+    return experiment;
+}
+
+// As in the solver execs, the flag parameters are off unless they are set
+static void clear_flags(mofjssp::Solver &) {}
+
+static void clear_flags(mofjssp::NSPSO_Solver & solver) {
+    solver.memory = false;
+}
+
+static void clear_flags(mofjssp::MOEAD_Solver & solver) {
+    solver.preserve_diversity = false;
+}
+
+static void clear_flags(mofjssp::MHACO_Solver & solver) {
+    solver.memory = false;
+}
+
+static void set_parameter(mofjssp::NSGA2_Solver & solver,
+                          const std::string & name,
+                          const std::string & value) {
+    if(name == "population-size") {
+        solver.population_size = std::stoul(value);
+    } else if(name == "crossover-probability") {
+        solver.crossover_probability = std::stod(value);
+    } else if(name == "crossover-distribution") {
+        solver.crossover_distribution = std::stod(value);
+    } else if(name == "mutation-probability") {
+        solver.mutation_probability = std::stod(value);
+    } else if(name == "mutation-distribution") {
+        solver.mutation_distribution = std::stod(value);
+    } else {
+        throw std::runtime_error("Unknown nsga2 parameter " + name + ".");
+    }
+}
+
+static void set_parameter(mofjssp::NSPSO_Solver & solver,
+                          const std::string & name,
+                          const std::string & value) {
+    if(name == "population-size") {
+        solver.population_size = std::stoul(value);
+    } else if(name == "omega") {
+        solver.omega = std::stod(value);
+    } else if(name == "c1") {
+        solver.c1 = std::stod(value);
+    } else if(name == "c2") {
+        solver.c2 = std::stod(value);
+    } else if(name == "chi") {
+        solver.chi = std::stod(value);
+    } else if(name == "v-coeff") {
+        solver.v_coeff = std::stod(value);
+    } else if(name == "leader-selection-range") {
+        solver.leader_selection_range = std::stoul(value);
+    } else if(name == "diversity-mechanism") {
+        solver.diversity_mechanism = value;
+    } else if(name == "memory") {
+        solver.memory = true;
+    } else {
+        throw std::runtime_error("Unknown nspso parameter " + name + ".");
+    }
+}
+
+static void set_parameter(mofjssp::MOEAD_Solver & solver,
+                          const std::string & name,
+                          const std::string & value) {
+    if(name == "population-size") {
+        solver.population_size = std::stoul(value);
+    } else if(name == "weight-generation") {
+        solver.weight_generation = value;
+    } else if(name == "decomposition") {
+        solver.decomposition = value;
+    } else if(name == "neighbours") {
+        solver.neighbours = std::stoul(value);
+    } else if(name == "cr") {
+        solver.cr = std::stod(value);
+    } else if(name == "f") {
+        solver.f = std::stod(value);
+    } else if(name == "eta-m") {
+        solver.eta_m = std::stod(value);
+    } else if(name == "realb") {
+        solver.realb = std::stod(value);
+    } else if(name == "limit") {
+        solver.limit = std::stoul(value);
+    } else if(name == "preserve-diversity") {
+        solver.preserve_diversity = true;
+    } else {
+        throw std::runtime_error("Unknown moead parameter " + name + ".");
+    }
+}
+
+static void set_parameter(mofjssp::MHACO_Solver & solver,
+                          const std::string & name,
+                          const std::string & value) {
+    if(name == "population-size") {
+        solver.population_size = std::stoul(value);
+    } else if(name == "ker") {
+        solver.ker = std::stoul(value);
+    } else if(name == "q") {
+        solver.q = std::stod(value);
+    } else if(name == "threshold") {
+        solver.threshold = std::stoul(value);
+    } else if(name == "n-gen-mark") {
+        solver.n_gen_mark = std::stoul(value);
+    } else if(name == "eval-stop") {
+        solver.eval_stop = std::stoul(value);
+    } else if(name == "focus") {
+        solver.focus = std::stod(value);
+    } else if(name == "memory") {
+        solver.memory = true;
+    } else {
+        throw std::runtime_error("Unknown mhaco parameter " + name + ".");
+    }
+}
+
+static void set_parameter(mofjssp::IHS_Solver & solver,
+                          const std::string & name,
+                          const std::string & value) {
+    if(name == "population-size") {
+        solver.population_size = std::stoul(value);
+    } else if(name == "phmcr") {
+        solver.phmcr = std::stod(value);
+    } else if(name == "ppar-min") {
+        solver.ppar_min = std::stod(value);
+    } else if(name == "ppar-max") {
+        solver.ppar_max = std::stod(value);
+    } else if(name == "bw-min") {
+        solver.bw_min = std::stod(value);
+    } else if(name == "bw-max") {
+        solver.bw_max = std::stod(value);
+    } else {
+        throw std::runtime_error("Unknown ihs parameter " + name + ".");
+    }
+}
+
+static void set_parameter(mofjssp::NSBRKGA_Solver & solver,
+                          const std::string & name,
+                          const std::string & value) {
+    if(name == "population-size") {
+        solver.population_size = std::stoul(value);
+    } else if(name == "min-elites-percentage") {
+        solver.min_elites_percentage = std::stod(value);
+    } else if(name == "max-elites-percentage") {
+        solver.max_elites_percentage = std::stod(value);
+    } else if(name == "mutation-probability") {
+        solver.mutation_probability = std::stod(value);
+    } else if(name == "mutation-distribution") {
+        solver.mutation_distribution = std::stod(value);
+    } else if(name == "num-total-parents") {
+        solver.num_total_parents = std::stoul(value);
+    } else if(name == "num-elite-parents") {
+        solver.num_elite_parents = std::stoul(value);
+    } else if(name == "bias-type") {
+        std::stringstream ss(value);
+        ss >> solver.bias_type;
+    } else if(name == "diversity-type") {
+        std::stringstream ss(value);
+        ss >> solver.diversity_type;
+    } else if(name == "num-populations") {
+        solver.num_populations = std::stoul(value);
+    } else if(name == "exchange-interval") {
+        solver.exchange_interval = std::stoul(value);
+    } else if(name == "num-exchange-individuals") {
+        solver.num_exchange_individuals = std::stoul(value);
+    } else if(name == "pr-type") {
+        std::stringstream ss(value);
+        ss >> solver.pr_type;
+    } else if(name == "pr-dist-func") {
+        std::string s = value;
+        std::transform(s.begin(), s.end(), s.begin(), ::toupper);
+
+        if (s.compare("HAMMING") == 0 || s.compare("KENDALL_TAU") == 0) {
+            solver.pr_dist_func =
+                std::shared_ptr<NSBRKGA::DistanceFunctionBase>(
+                    new NSBRKGA::KendallTauDistance());
+        } else if (s.compare("EUCLIDEAN") == 0) {
+            solver.pr_dist_func =
+                std::shared_ptr<NSBRKGA::DistanceFunctionBase>(
+                    new NSBRKGA::EuclideanDistance());
+        }
+    } else if(name == "pr-percentage") {
+        solver.pr_percentage = std::stod(value);
+    } else if(name == "pr-interval") {
+        solver.pr_interval = std::stoul(value);
+    } else if(name == "shake-interval") {
+        solver.shake_interval = std::stoul(value);
+    } else if(name == "shake-intensity") {
+        solver.shake_intensity = std::stod(value);
+    } else if(name == "shake-distribution") {
+        solver.shake_distribution = std::stod(value);
+    } else if(name == "reset-interval") {
+        solver.reset_interval = std::stoul(value);
+    } else if(name == "reset-intensity") {
+        solver.reset_intensity = std::stod(value);
+    } else if(name == "num-threads") {
+        solver.num_threads = std::stoul(value);
+    } else {
+        throw std::runtime_error("Unknown nsbrkga parameter " + name + ".");
+    }
+}
+
+// The number of threads run by a run of a solver, which it takes from
+// those of the runner
+static unsigned num_threads_of_run(const Experiment & experiment,
+                                   const std::string & solver_name) {
+    unsigned num_threads = 1;
+
+    if(solver_name == "nsbrkga" &&
+            experiment.parameters.count(solver_name) > 0) {
+        for(const auto & [name, value] :
+                experiment.parameters.at(solver_name)) {
+            if(name == "num-threads") {
+                num_threads = std::stoul(value);
+            }
+        }
+    }
+
+    return num_threads;
+}
+
+static void check_stream(const std::ofstream & ofs,
+                         const std::string & filename) {
+    if(ofs.eof() || ofs.fail() || ofs.bad()) {
+        throw std::runtime_error("Error writing file " + filename + ".");
+    }
+}
+
+static std::ofstream open_file(const std::string & filename) {
+    std::ofstream ofs(filename);
+
+    if(!ofs.is_open()) {
+        throw std::runtime_error("File " + filename + " not created.");
+    }
+
+    return ofs;
+}
+
+template <class V>
+static void write_values(std::ostream & os, const V & value) {
+    for(unsigned i = 0; i < value.size() - 1; i++) {
+        os << value[i] << " ";
+    }
+
+    os << value.back() << std::endl;
+}
+
+static void write_pareto(const mofjssp::Solver & solver,
+                         const std::string & filename) {
+    std::ofstream ofs = open_file(filename);
+
+    for(const auto & solution : solver.best_solutions) {
+        write_values(ofs, solution.value);
+    }
+
+    check_stream(ofs, filename);
+}
+
+static void write_best_solutions_snapshots(const mofjssp::Solver & solver,
+                                           const std::string & prefix) {
+    for(unsigned i = 0; i < solver.best_solutions_snapshots.size(); i++) {
+        const std::string filename = prefix + std::to_string(i) + ".txt";
+        std::ofstream ofs = open_file(filename);
+        const auto & [iteration, time, best_solutions] =
+            solver.best_solutions_snapshots[i];
+
+        ofs << iteration << " " << time << std::endl;
+
+        for(const auto & value : best_solutions) {
+            write_values(ofs, value);
+        }
+
+        check_stream(ofs, filename);
+    }
+}
+
+static void write_count_snapshots(
+        const std::vector<std::tuple<unsigned, double, std::vector<unsigned>>> &
+            snapshots,
+        const std::string & filename) {
+    std::ofstream ofs = open_file(filename);
+
+    for(const auto & [iteration, time, counts] : snapshots) {
+        ofs << iteration << " " << time << " ";
+
+        for(unsigned j = 0; j < counts.size() - 1; j++) {
+            ofs << counts[j] << " ";
+        }
+
+        ofs << counts.back() << std::endl;
+    }
+
+    check_stream(ofs, filename);
+}
+
+static void write_populations_snapshots(const mofjssp::Solver & solver,
+                                        const std::string & prefix) {
+    for(unsigned i = 0; i < solver.populations_snapshots.size(); i++) {
+        const std::string filename = prefix + std::to_string(i) + ".txt";
+        std::ofstream ofs = open_file(filename);
+        const auto & [iteration, time, populations] =
+            solver.populations_snapshots[i];
+
+        ofs << iteration << " " << time << std::endl;
+
+        for(const auto & population : populations) {
+            for(const auto & value : population) {
+                write_values(ofs, value);
+            }
+        }
+
+        check_stream(ofs, filename);
+    }
+}
+
+template <class S>
+static void run(const Experiment & experiment,
+                const std::shared_ptr<const mofjssp::Instance> & instance,
+                const std::string & instance_name,
+                const std::string & solver_name,
+                unsigned seed,
+                const std::shared_ptr<mofjssp::Archive> & archive) {
+    const std::string & directory = experiment.output_directory;
+    const std::string run_name = instance_name + "_" + solver_name + "_" +
+                                 std::to_string(seed);
+    S solver(instance);
+
+    solver.set_seed(seed);
+    solver.time_limit = experiment.time_limit;
+    solver.iterations_limit = experiment.iterations_limit;
+    solver.max_num_solutions = experiment.max_num_solutions;
+    solver.max_num_snapshots = experiment.max_num_snapshots;
+    solver.decode_cache_size = experiment.decode_cache_size;
+    solver.local_search = experiment.local_search;
+    solver.local_search_interval = experiment.local_search_interval;
+    solver.local_search_sample_size = experiment.local_search_sample_size;
+    solver.active_schedule = experiment.active_schedule;
+    solver.key_precision = experiment.key_precision;
+    solver.hypervolume_targets = experiment.hypervolume_targets;
+    solver.truncation = experiment.truncation;
+    solver.archive = archive;
+    // The runs are already spread over the threads
+    solver.num_materialization_threads = 1;
+    clear_flags(solver);
+
+    if(experiment.parameters.count(solver_name) > 0) {
+        for(const auto & [name, value] :
+                experiment.parameters.at(solver_name)) {
+            set_parameter(solver, name, value);
+        }
+    }
+
+    solver.solve();
+
+    {
+        const std::string filename = directory + "/statistics/" + run_name +
+                                     ".txt";
+        std::ofstream ofs = open_file(filename);
+        ofs << solver;
+        check_stream(ofs, filename);
+    }
+
+    write_pareto(solver, directory + "/pareto/" + run_name + ".txt");
+    write_best_solutions_snapshots(solver,
+            directory + "/best_solutions_snapshots/" + run_name + "_");
+    write_count_snapshots(solver.num_non_dominated_snapshots,
+            directory + "/num_non_dominated_snapshots/" + run_name + ".txt");
+    write_count_snapshots(solver.num_fronts_snapshots,
+            directory + "/num_fronts_snapshots/" + run_name + ".txt");
+    write_populations_snapshots(solver,
+            directory + "/populations_snapshots/" + run_name + "_");
+
+    if constexpr (std::is_same<S, mofjssp::NSBRKGA_Solver>::value) {
+        write_count_snapshots(solver.num_elites_snapshots,
+                directory + "/num_elites_snapshots/" + run_name + ".txt");
+    }
+}
+
+int main(int argc, char * argv[]) {
+    Argument_Parser arg_parser(argc, argv);
+
+    if(arg_parser.option_exists("--manifest")) {
+        const Experiment experiment =
+            read_experiment(arg_parser.option_value("--manifest"));
+        unsigned num_threads = std::thread::hardware_concurrency();
+        std::map<std::string, std::shared_ptr<const mofjssp::Instance>>
+            instances;
+        std::map<std::string, std::shared_ptr<mofjssp::Archive>> archives;
+        std::vector<std::tuple<std::string, std::string, unsigned>> runs;
+        std::mutex output_mutex;
+        bool failed = false;
+
+        if(arg_parser.option_exists("--num-threads")) {
+            num_threads = std::stoul(arg_parser.option_value("--num-threads"));
+        }
+
+        for(const std::string & filename : experiment.instance_filenames) {
+            const std::string instance_name =
+                std::filesystem::path(filename).stem().string();
+            instances[instance_name] = mofjssp::Instance::load(filename);
+
+            if(experiment.shared_archive) {
+                // The runs publish the individuals of each update, so a
+                // batch spans a few updates of a few runs
+                archives[instance_name] = std::make_shared<mofjssp::Archive>(
+                        instances[instance_name]->senses,
+                        experiment.max_num_solutions,
+                        256,
+                        num_threads);
+            }
+
+            for(const std::string & solver_name : experiment.solvers) {
+                for(const unsigned & seed : experiment.seeds) {
+                    runs.push_back(std::make_tuple(instance_name,
+                                                   solver_name,
+                                                   seed));
+                }
+            }
+        }
+
+        // Larger instances first, so that the longest runs do not end up
+        // alone at the end of the campaign
+        std::stable_sort(runs.begin(), runs.end(),
+                [&instances](const auto & a, const auto & b) {
+                    return instances.at(std::get<0>(a))->total_num_operations >
+                           instances.at(std::get<0>(b))->total_num_operations;
+                });
+
+        for(const char * subdirectory : {"statistics",
+                                         "pareto",
+                                         "best_solutions_snapshots",
+                                         "num_non_dominated_snapshots",
+                                         "num_fronts_snapshots",
+                                         "populations_snapshots",
+                                         "num_elites_snapshots",
+                                         "shared_pareto"}) {
+            std::filesystem::create_directories(
+                    experiment.output_directory + "/" + subdirectory);
+        }
+
+        Thread_Pool pool(num_threads);
+
+        for(const auto & [instance_name, solver_name, seed] : runs) {
+            pool.submit([&, instance_name = instance_name,
+                            solver_name = solver_name,
+                            seed = seed]() {
+                const auto & instance = instances.at(instance_name);
+                const auto archive = experiment.shared_archive ?
+                    archives.at(instance_name) : nullptr;
+                const auto start_time = std::chrono::steady_clock::now();
+
+                try {
+                    if(solver_name == "nsga2") {
+                        run<mofjssp::NSGA2_Solver>(experiment, instance,
+                                instance_name, solver_name, seed,
+                                archive);
+                    } else if(solver_name == "nspso") {
+                        run<mofjssp::NSPSO_Solver>(experiment, instance,
+                                instance_name, solver_name, seed,
+                                archive);
+                    } else if(solver_name == "moead") {
+                        run<mofjssp::MOEAD_Solver>(experiment, instance,
+                                instance_name, solver_name, seed,
+                                archive);
+                    } else if(solver_name == "mhaco") {
+                        run<mofjssp::MHACO_Solver>(experiment, instance,
+                                instance_name, solver_name, seed,
+                                archive);
+                    } else if(solver_name == "ihs") {
+                        run<mofjssp::IHS_Solver>(experiment, instance,
+                                instance_name, solver_name, seed,
+                                archive);
+                    } else if(solver_name == "nsbrkga") {
+                        run<mofjssp::NSBRKGA_Solver>(experiment, instance,
+                                instance_name, solver_name, seed,
+                                archive);
+                    } else {
+                        throw std::runtime_error("Unknown solver " +
+                                                 solver_name + ".");
+                    }
+
+                    std::lock_guard<std::mutex> lock(output_mutex);
+                    std::cout << instance_name << " " << solver_name << " "
+                              << seed << " finished in "
+                              << mofjssp::Solver::elapsed_time(start_time)
+                              << " seconds." << std::endl;
+                } catch(const std::exception & e) {
+                    std::lock_guard<std::mutex> lock(output_mutex);
+                    std::cerr << instance_name << " " << solver_name << " "
+                              << seed << " failed: " << e.what() << std::endl;
+                    failed = true;
+                }
+            }, num_threads_of_run(experiment, solver_name));
+        }
+
+        pool.wait();
+
+        for(const auto & [instance_name, archive] : archives) {
+            const std::string filename = experiment.output_directory +
+                                         "/shared_pareto/" + instance_name +
+                                         ".txt";
+            std::ofstream ofs = open_file(filename);
+
+            archive->flush();
+
+            for(const auto & individual : *archive->snapshot()) {
+                write_values(ofs, individual.first);
+            }
+
+            check_stream(ofs, filename);
+        }
+
+        if(failed) {
+            return 1;
+        }
+    } else {
+        std::cerr << "./experiment_runner_exec "
+                  << "--manifest <manifest_filename> "
+                  << "--num-threads <num_threads> "
+                  << std::endl;
+    }
+
+    return 0;
+}
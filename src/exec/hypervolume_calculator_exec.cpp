@@ -1,49 +1,11 @@
 #include "instance/instance.hpp"
+#include "solver/objective_space.hpp"
 #include "utils/argument_parser.hpp"
-#include <pagmo/utils/hypervolume.hpp>
+#include "utils/results_store.hpp"
+#include "utils/thread_pool.hpp"
+#include <filesystem>
 #include <fstream>
 
-static inline
-double compute_hypervolume(
-        const std::vector<NSBRKGA::Sense> & senses,
-        const std::vector<double> & reference_point,
-        const std::vector<std::vector<double>> & front) {
-    std::vector<double> reference_point_prime(reference_point.size());
-    std::vector<std::vector<double>> front_prime(front.size());
-
-    for (unsigned i = 0; i < reference_point.size(); i++) {
-        if (senses[i] == NSBRKGA::Sense::MINIMIZE) {
-            reference_point_prime[i] = reference_point[i];
-        } else {
-            reference_point_prime[i] = -reference_point[i];
-        }
-    }
-
-    for (unsigned i = 0; i < front.size(); i++) {
-        front_prime[i] = std::vector<double>(front[i].size());
-        for (unsigned j = 0; j < front[i].size(); j++) {
-            if (senses[j] == NSBRKGA::Sense::MINIMIZE) {
-                front_prime[i][j] = front[i][j];
-            } else {
-                front_prime[i][j] = -front[i][j];
-            }
-        }
-    }
-
-    pagmo::hypervolume hv(front_prime);
-    return hv.compute(reference_point_prime);
-}
-
-static inline
-double compute_hypervolume_ratio(
-        const double & reference_hypervolume,
-        const std::vector<NSBRKGA::Sense> & senses,
-        const std::vector<double> & reference_point,
-        const std::vector<std::vector<double>> & front) {
-    double hypervolume = compute_hypervolume(senses, reference_point, front);
-    return hypervolume / reference_hypervolume;
-}
-
 int main(int argc, char * argv[]) {
     Argument_Parser arg_parser(argc, argv);
 
@@ -63,15 +25,19 @@ int main(int argc, char * argv[]) {
                     arg_parser.option_value("--instance") + " not found.");
         }
 
-        std::vector<double> reference_point = instance.primal_bound;
+        mofjssp::Reference_Point reference_point_type =
+            mofjssp::Reference_Point::PRIMAL_BOUND;
+
+        if(arg_parser.option_exists("--reference-point")) {
+            reference_point_type = mofjssp::parse_reference_point(
+                    arg_parser.option_value("--reference-point"));
+        }
+
         std::vector<std::vector<double>> reference_pareto;
-        double reference_hypervolume;
-        std::vector<std::vector<std::vector<double>>> paretos;
         std::vector<std::vector<unsigned>> iteration_snapshots;
         std::vector<std::vector<double>> time_snapshots;
-        std::vector<std::vector<std::vector<std::vector<double>>>>
-            best_solutions_snapshots;
-        unsigned num_solvers;
+        unsigned num_solvers,
+                 num_threads = std::thread::hardware_concurrency();
 
         ifs.open(arg_parser.option_value("--reference-pareto"));
 
@@ -94,11 +60,25 @@ int main(int argc, char * argv[]) {
                     " not found.");
         }
 
-        reference_hypervolume = compute_hypervolume(instance.senses,
-                                                    reference_point,
-                                                    reference_pareto);
+        // The reference point is widened past the nadir point of the
+        // reference front, which the heuristic bound may not bound
+        const std::vector<double> reference_point =
+            mofjssp::Objective_Space::bounding_reference_point(
+                    instance.senses,
+                    instance.reference_point(reference_point_type),
+                    reference_pareto);
+        const mofjssp::Objective_Space objective_space(instance.senses,
+                                                       reference_point,
+                                                       reference_pareto);
+
+        if(objective_space.reference_hypervolume == 0.0) {
+            throw std::runtime_error("The reference front bounds no "
+                    "hypervolume with respect to the reference point.");
+        }
 
-        assert(reference_hypervolume > 0.0);
+        if(arg_parser.option_exists("--num-threads")) {
+            num_threads = std::stoul(arg_parser.option_value("--num-threads"));
+        }
 
         for(num_solvers = 0;
             arg_parser.option_exists("--pareto-" +
@@ -111,160 +91,177 @@ int main(int argc, char * argv[]) {
                                      std::to_string(num_solvers));
             num_solvers++) {}
 
-        paretos.resize(num_solvers);
+        std::vector<double> hypervolume_ratios(num_solvers);
+        std::vector<std::vector<double>> hypervolume_ratio_snapshots(num_solvers);
+        Thread_Pool pool(std::max(1u, num_threads));
+
         iteration_snapshots.resize(num_solvers);
         time_snapshots.resize(num_solvers);
-        best_solutions_snapshots.resize(num_solvers);
 
+        // Each run is processed by a task, which reads its fronts one at
+        // a time, so that at most one front per thread is in memory
         for(unsigned i = 0; i < num_solvers; i++) {
-            if(arg_parser.option_exists("--pareto-" + std::to_string(i))) {
-                ifs.open(arg_parser.option_value("--pareto-" +
-                                                 std::to_string(i)));
-
-                if(ifs.is_open()) {
-                    for(std::string line; std::getline(ifs, line);) {
-                        std::istringstream iss(line);
-                        std::vector<double> value(instance.num_objectives, 0.0);
-
-                        for(unsigned j = 0; j < instance.num_objectives; j++) {
-                            iss >> value[j];
-                        }
-
-                        paretos[i].push_back(value);
+            pool.submit([&, i]() {
+                std::ifstream ifs;
+                mofjssp::Objective_Space::Front front;
+
+                if(arg_parser.option_exists("--pareto-" + std::to_string(i))) {
+                    ifs.open(arg_parser.option_value("--pareto-" +
+                                                     std::to_string(i)));
+
+                    if(!ifs.is_open()) {
+                        throw std::runtime_error("File " +
+                                arg_parser.option_value("--pareto-" +
+                                    std::to_string(i)) + " not found.");
                     }
 
+                    front = objective_space.read_front(ifs);
                     ifs.close();
-                } else {
-                    throw std::runtime_error("File " +
-                            arg_parser.option_value("--pareto-" +
-                                std::to_string(i)) + " not found.");
                 }
-            }
-        }
 
-        for(unsigned i = 0; i < num_solvers; i++) {
-            if(arg_parser.option_exists("--best-solutions-snapshots-" +
-                                        std::to_string(i))) {
-                std::string best_solutions_snapshots_filename =
-                    arg_parser.option_value("--best-solutions-snapshots-" +
-                                            std::to_string(i));
+                hypervolume_ratios[i] = objective_space.hypervolume_ratio(front);
 
-                for(unsigned j = 0; ; j++) {
-                    ifs.open(best_solutions_snapshots_filename +
-                             std::to_string(j) + ".txt");
+                assert(hypervolume_ratios[i] >= 0.0);
+                assert(hypervolume_ratios[i] <= 1.0);
+
+                if(arg_parser.option_exists("--best-solutions-snapshots-" +
+                                            std::to_string(i))) {
+                    std::string best_solutions_snapshots_filename =
+                        arg_parser.option_value("--best-solutions-snapshots-" +
+                                                std::to_string(i));
+
+                    for(unsigned j = 0; ; j++) {
+                        ifs.open(best_solutions_snapshots_filename +
+                                 std::to_string(j) + ".txt");
+
+                        if(!ifs.is_open()) {
+                            break;
+                        }
 
-                    if(ifs.is_open()) {
                         unsigned iteration;
                         double time;
 
                         ifs >> iteration >> time;
+                        ifs.ignore();
 
                         iteration_snapshots[i].push_back(iteration);
                         time_snapshots[i].push_back(time);
-                        best_solutions_snapshots[i].emplace_back();
+                        front = objective_space.read_front(ifs);
+                        ifs.close();
+                        ifs.clear();
 
-                        ifs.ignore();
+                        hypervolume_ratio_snapshots[i].push_back(
+                                objective_space.hypervolume_ratio(front));
 
-                        for(std::string line; std::getline(ifs, line);) {
-                            std::istringstream iss(line);
-                            std::vector<double> value(instance.num_objectives,
-                                                      0.0);
+                        assert(hypervolume_ratio_snapshots[i].back() >= 0.0);
+                        assert(hypervolume_ratio_snapshots[i].back() <= 1.0);
+                    }
+                }
 
-                            for(unsigned j = 0;
-                                j < instance.num_objectives;
-                                j++) {
-                                iss >> value[j];
-                            }
+                if(arg_parser.option_exists("--hypervolume-" + std::to_string(i))) {
+                    std::ofstream ofs;
+                    ofs.open(arg_parser.option_value("--hypervolume-" +
+                                                     std::to_string(i)));
 
-                            best_solutions_snapshots[i].back().push_back(value);
+                    if(ofs.is_open()) {
+                        ofs << hypervolume_ratios[i] << std::endl;
+
+                        if(ofs.eof() || ofs.fail() || ofs.bad()) {
+                            throw std::runtime_error("Error writing file " +
+                                    arg_parser.option_value("--hypervolume-" +
+                                        std::to_string(i)) + ".");
                         }
 
-                        ifs.close();
+                        ofs.close();
                     } else {
-                        break;
+                        throw std::runtime_error("File " +
+                                arg_parser.option_value("--hypervolume-" +
+                                    std::to_string(i)) + " not created.");
                     }
                 }
-            }
-        }
 
-        for(unsigned i = 0; i < num_solvers; i++) {
-            std::ofstream ofs;
-
-            ofs.open(arg_parser.option_value("--hypervolume-" +
-                                             std::to_string(i)));
-
-            if(ofs.is_open()) {
-                double hypervolume_ratio = compute_hypervolume_ratio(
-                        reference_hypervolume,
-                        instance.senses,
-                        reference_point,
-                        paretos[i]);
-                
-                assert(hypervolume_ratio >= 0.0);
-                assert(hypervolume_ratio <= 1.0);
-
-                ofs << hypervolume_ratio << std::endl;
-
-                if(ofs.eof() || ofs.fail() || ofs.bad()) {
-                    throw std::runtime_error("Error writing file " +
-                            arg_parser.option_value("--hypervolume-" +
-                                std::to_string(i)) + ".");
-                }
+                if(arg_parser.option_exists("--hypervolume-snapshots-" +
+                                            std::to_string(i))) {
+                    std::ofstream ofs;
 
-                ofs.close();
-            } else {
-                throw std::runtime_error("File " +
-                        arg_parser.option_value("--hypervolume-" +
-                            std::to_string(i)) + " not created.");
-            }
-        }
+                    ofs.open(arg_parser.option_value("--hypervolume-snapshots-" +
+                                                     std::to_string(i)));
 
-        for(unsigned i = 0; i < num_solvers; i++) {
-            std::ofstream ofs;
-
-            ofs.open(arg_parser.option_value("--hypervolume-snapshots-" +
-                                             std::to_string(i)));
-
-            if(ofs.is_open()) {
-                for(unsigned j = 0;
-                    j < best_solutions_snapshots[i].size();
-                    j++) {
-                    double hypervolume_ratio = compute_hypervolume_ratio(
-                            reference_hypervolume,
-                            instance.senses,
-                            reference_point,
-                            best_solutions_snapshots[i][j]);
-
-                    assert(hypervolume_ratio >= 0.0);
-                    assert(hypervolume_ratio <= 1.0);
-
-                    ofs << iteration_snapshots[i][j] << ","
-                        << time_snapshots[i][j] << ","
-                        << hypervolume_ratio << std::endl;
-
-                    if(ofs.eof() || ofs.fail() || ofs.bad()) {
-                        throw std::runtime_error("Error writing file " +
-                                arg_parser.option_value(
-                                    "--hypervolume-snapshots-" +
-                                    std::to_string(i)) + ".");
+                    if(ofs.is_open()) {
+                        for(unsigned j = 0; j < hypervolume_ratio_snapshots[i].size(); j++) {
+                            ofs << iteration_snapshots[i][j] << ","
+                                << time_snapshots[i][j] << ","
+                                << hypervolume_ratio_snapshots[i][j] << std::endl;
+
+                            if(ofs.eof() || ofs.fail() || ofs.bad()) {
+                                throw std::runtime_error("Error writing file " +
+                                        arg_parser.option_value(
+                                            "--hypervolume-snapshots-" +
+                                            std::to_string(i)) + ".");
+                            }
+                        }
+
+                        ofs.close();
+                    } else {
+                        throw std::runtime_error("File " +
+                                arg_parser.option_value("--hypervolume-snapshots-" +
+                                    std::to_string(i)) + " not created.");
                     }
                 }
+            });
+        }
+
+        pool.wait();
+
+        if(arg_parser.option_exists("--results")) {
+            std::vector<Results_Store::Row> rows;
 
-                ofs.close();
-            } else {
-                throw std::runtime_error("File " +
-                        arg_parser.option_value("--hypervolume-snapshots-" +
-                            std::to_string(i)) + " not created.");
+            for(unsigned i = 0; i < num_solvers; i++) {
+                if(!arg_parser.option_exists("--solver-" + std::to_string(i)) ||
+                   !arg_parser.option_exists("--seed-" + std::to_string(i))) {
+                    throw std::runtime_error("The solver and the seed of run " +
+                            std::to_string(i) + " are not given.");
+                }
+
+                const Results_Store::Row run = {
+                    std::filesystem::path(
+                            arg_parser.option_value("--instance")).stem().string(),
+                    arg_parser.option_value("--solver-" + std::to_string(i)),
+                    unsigned(std::stoul(arg_parser.option_value(
+                                    "--seed-" + std::to_string(i)))),
+                    Results_Store::FINAL_SNAPSHOT, 0, 0.0,
+                    instance.num_jobs,
+                    instance.num_machines,
+                    instance.total_num_operations,
+                    instance.num_objectives,
+                    {}
+                };
+                const auto run_rows = Results_Store::run_rows(
+                        run,
+                        Results_Store::HYPERVOLUME,
+                        hypervolume_ratios[i],
+                        iteration_snapshots[i],
+                        time_snapshots[i],
+                        hypervolume_ratio_snapshots[i]);
+
+                rows.insert(rows.end(), run_rows.begin(), run_rows.end());
             }
+
+            Results_Store::append(arg_parser.option_value("--results"), rows);
         }
     } else {
         std::cerr << "./hypervolume_calculator_exec "
                   << "--instance <instance_filename> "
                   << "--reference-pareto <reference_pareto_filename> "
+                  << "--reference-point <primal|heuristic> "
                   << "--pareto-i <pareto_filename> "
                   << "--best-solutions-snapshots-i <best_solutions_snapshots_filename> "
                   << "--hypervolume-i <hypervolume_filename> "
                   << "--hypervolume-snapshots-i <hypervolume_snapshots_filename> "
+                  << "--solver-i <solver> "
+                  << "--seed-i <seed> "
+                  << "--results <results_filename> "
+                  << "--num-threads <num_threads> "
                   << std::endl;
     }
 
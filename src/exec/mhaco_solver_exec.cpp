@@ -1,29 +1,14 @@
 #include "utils/argument_parser.hpp"
+#include "utils/profiler.hpp"
 #include "solver/mhaco/mhaco_solver.hpp"
+#include <sstream>
 
 int main (int argc, char * argv[]) {
     Argument_Parser arg_parser(argc, argv);
 
     if(arg_parser.option_exists("--instance")) {
-        std::ifstream ifs;
-        mofjssp::Instance instance;
-
-        ifs.open(arg_parser.option_value("--instance"));
-
-        if(ifs.is_open()) {
-            ifs >> instance;
-
-            if(ifs.eof() || ifs.fail() || ifs.bad()) {
-                throw std::runtime_error("Error reading file " +
-                        arg_parser.option_value("--instance") + ".");
-            }
-
-            ifs.close();
-        } else {
-            throw std::runtime_error("File " +
-                    arg_parser.option_value("--instance") + " not found.");
-        }
-
+        const auto instance =
+            mofjssp::Instance::load(arg_parser.option_value("--instance"));
         mofjssp::MHACO_Solver solver(instance);
 
         if(arg_parser.option_exists("--seed")) {
@@ -50,6 +35,43 @@ int main (int argc, char * argv[]) {
                 std::stoul(arg_parser.option_value("--max-num-snapshots"));
         }
 
+        if(arg_parser.option_exists("--decode-cache-size")) {
+            solver.decode_cache_size =
+                std::stoul(arg_parser.option_value("--decode-cache-size"));
+        }
+
+        if(arg_parser.option_exists("--local-search-interval")) {
+            solver.local_search_interval =
+                std::stoul(arg_parser.option_value("--local-search-interval"));
+        }
+
+        if(arg_parser.option_exists("--local-search-sample-size")) {
+            solver.local_search_sample_size = std::stoul(
+                    arg_parser.option_value("--local-search-sample-size"));
+        }
+
+        solver.local_search = arg_parser.option_exists("--local-search");
+        solver.active_schedule = arg_parser.option_exists("--active-schedule");
+
+        if(arg_parser.option_exists("--key-precision")) {
+            solver.key_precision = mofjssp::parse_key_precision(
+                    arg_parser.option_value("--key-precision"));
+        }
+
+        if(arg_parser.option_exists("--hypervolume-targets")) {
+            std::istringstream iss(
+                    arg_parser.option_value("--hypervolume-targets"));
+
+            for(double target; iss >> target;) {
+                solver.hypervolume_targets.push_back(target);
+            }
+        }
+
+        if(arg_parser.option_exists("--truncation")) {
+            solver.truncation = mofjssp::parse_truncation(
+                    arg_parser.option_value("--truncation"));
+        }
+
         if(arg_parser.option_exists("--population-size")) {
             solver.population_size =
                 std::stoul(arg_parser.option_value("--population-size"));
@@ -92,6 +114,7 @@ int main (int argc, char * argv[]) {
 
             if(ofs.is_open()) {
                 ofs << solver;
+                Profiler::write_statistics(ofs);
 
                 if(ofs.eof() || ofs.fail() || ofs.bad()) {
                     throw std::runtime_error("Error writing file " +
@@ -106,6 +129,26 @@ int main (int argc, char * argv[]) {
             }
         }
 
+        if(arg_parser.option_exists("--trace")) {
+            std::ofstream ofs;
+            ofs.open(arg_parser.option_value("--trace"));
+
+            if(ofs.is_open()) {
+                Profiler::write_trace(ofs);
+
+                if(ofs.eof() || ofs.fail() || ofs.bad()) {
+                    throw std::runtime_error("Error writing file " +
+                            arg_parser.option_value("--trace") + ".");
+                }
+
+                ofs.close();
+            } else {
+                throw std::runtime_error(
+                        "File " + arg_parser.option_value("--trace") +
+                        " not created.");
+            }
+        }
+
         if(arg_parser.option_exists("--solutions")) {
             std::string solution_filename =
                 arg_parser.option_value("--solutions");
@@ -174,7 +217,7 @@ int main (int argc, char * argv[]) {
                         std::get<0>(solver.best_solutions_snapshots[i]);
                     double time =
                         std::get<1>(solver.best_solutions_snapshots[i]);
-                    std::vector<std::vector<double>> best_solutions =
+                    const auto & best_solutions =
                         std::get<2>(solver.best_solutions_snapshots[i]);
 
                     ofs << iteration << " "
@@ -303,7 +346,7 @@ int main (int argc, char * argv[]) {
                         std::get<0>(solver.populations_snapshots[i]);
                     double time =
                         std::get<1>(solver.populations_snapshots[i]);
-                    std::vector<std::vector<std::vector<double>>> population =
+                    const auto & population =
                         std::get<2>(solver.populations_snapshots[i]);
 
                     ofs << iteration << " "
@@ -342,6 +385,14 @@ int main (int argc, char * argv[]) {
                   << "--iterations-limit <iterations_limit> "
                   << "--max-num-solutions <max_num_solutions> "
                   << "--max-num-snapshots <max_num_snapshots> "
+                  << "--decode-cache-size <decode_cache_size> "
+                  << "--local-search "
+                  << "--local-search-interval <local_search_interval> "
+                  << "--local-search-sample-size <local_search_sample_size> "
+                  << "--active-schedule "
+                  << "--key-precision <double|float|fixed16> "
+                  << "--hypervolume-targets \"<ratio> ...\" "
+                  << "--truncation <crowding|hypervolume> "
                   << "--population-size <population_size> "
                   << "--ker <ker> "
                   << "--q <q> "
@@ -351,6 +402,7 @@ int main (int argc, char * argv[]) {
                   << "--focus <focus> "
                   << "--memory "
                   << "--statistics <statistics_filename> "
+                  << "--trace <trace_filename> "
                   << "--solutions <solutions_filename> "
                   << "--pareto <pareto_filename> "
                   << "--best-solutions-snapshots <best_solutions_snapshots_filename> "
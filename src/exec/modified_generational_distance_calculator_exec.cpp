@@ -1,71 +1,12 @@
 #include "instance/instance.hpp"
+#include "solver/objective_space.hpp"
 #include "utils/argument_parser.hpp"
+#include "utils/results_store.hpp"
+#include "utils/thread_pool.hpp"
 #include <cassert>
+#include <filesystem>
 #include <fstream>
 
-static inline
-double modified_distance(const std::vector<NSBRKGA::Sense> & senses,
-                         const std::vector<double> & reference_point,
-                         const std::vector<double> & point) {
-    double distance = 0.0, delta;
-
-    for(unsigned i = 0; i < senses.size(); i++) {
-        delta = 0;
-
-        if(senses[i] == NSBRKGA::Sense::MINIMIZE) {
-            if(point[i] > reference_point[i]) {
-                delta = point[i] - reference_point[i];
-            }
-        } else { // senses[i] == NSBRKGA::Sense::MAXIMIZE
-            if(reference_point[i] > point[i]) {
-                delta = reference_point[i] - point[i];
-            }
-        }
-
-        distance += delta * delta;
-    }
-
-    return sqrt(distance);
-}
-
-static inline
-double modified_inverted_generational_distance(
-        const std::vector<NSBRKGA::Sense> & senses,
-        const std::vector<std::vector<double>> & reference_front,
-        const std::vector<std::vector<double>> & front) {
-    double igd_plus = 0.0, min_distance, distance;
-
-    for(unsigned i = 0; i < reference_front.size(); i++) {
-        min_distance = modified_distance(senses,
-                                         reference_front[i],
-                                         front.front());
-
-        for(unsigned j = 1; j < front.size(); j++) {
-            distance = modified_distance(senses, reference_front[i], front[j]);
-
-            if(distance < min_distance) {
-                min_distance = distance;
-            }
-        }
-
-        igd_plus += min_distance;
-    }
-
-    return igd_plus / reference_front.size();
-}
-
-static inline
-double normalized_modified_inverted_generational_distance(
-        const double & reference_igd_plus,
-        const std::vector<NSBRKGA::Sense> & senses,
-        const std::vector<std::vector<double>> & reference_front,
-        const std::vector<std::vector<double>> & front) {
-    double igd_plus = modified_inverted_generational_distance(senses,
-                                                              reference_front,
-                                                              front);
-    return igd_plus / reference_igd_plus;
-}
-
 int main(int argc, char * argv[]) {
     Argument_Parser arg_parser(argc, argv);
 
@@ -85,15 +26,19 @@ int main(int argc, char * argv[]) {
                     arg_parser.option_value("--instance") + " not found.");
         }
 
-        std::vector<double> reference_point = instance.primal_bound;
+        mofjssp::Reference_Point reference_point_type =
+            mofjssp::Reference_Point::PRIMAL_BOUND;
+
+        if(arg_parser.option_exists("--reference-point")) {
+            reference_point_type = mofjssp::parse_reference_point(
+                    arg_parser.option_value("--reference-point"));
+        }
+
         std::vector<std::vector<double>> reference_pareto;
-        double reference_igd_plus;
-        std::vector<std::vector<std::vector<double>>> paretos;
         std::vector<std::vector<unsigned>> iteration_snapshots;
         std::vector<std::vector<double>> time_snapshots;
-        std::vector<std::vector<std::vector<std::vector<double>>>>
-            best_solutions_snapshots;
-        unsigned num_solvers;
+        unsigned num_solvers,
+                 num_threads = std::thread::hardware_concurrency();
 
         ifs.open(arg_parser.option_value("--reference-pareto"));
 
@@ -116,12 +61,25 @@ int main(int argc, char * argv[]) {
                     " not found.");
         }
 
-        reference_igd_plus = modified_inverted_generational_distance(
-                instance.senses,
-                reference_pareto,
-                {reference_point});
+        // The reference point is widened past the nadir point of the
+        // reference front, which the heuristic bound may not bound
+        const std::vector<double> reference_point =
+            mofjssp::Objective_Space::bounding_reference_point(
+                    instance.senses,
+                    instance.reference_point(reference_point_type),
+                    reference_pareto);
+        const mofjssp::Objective_Space objective_space(instance.senses,
+                                                       reference_point,
+                                                       reference_pareto);
+
+        if(objective_space.reference_igd_plus == 0.0) {
+            throw std::runtime_error("The reference front has no IGD+ "
+                    "with respect to the reference point.");
+        }
 
-        assert(reference_igd_plus > 0.0);
+        if(arg_parser.option_exists("--num-threads")) {
+            num_threads = std::stoul(arg_parser.option_value("--num-threads"));
+        }
 
         for(num_solvers = 0;
             arg_parser.option_exists("--pareto-" +
@@ -134,159 +92,179 @@ int main(int argc, char * argv[]) {
                                      std::to_string(num_solvers));
             num_solvers++) {}
 
-        paretos.resize(num_solvers);
+        std::vector<double> normalized_igd_pluss(num_solvers);
+        std::vector<std::vector<double>> normalized_igd_plus_snapshots(num_solvers);
+        Thread_Pool pool(std::max(1u, num_threads));
+
         iteration_snapshots.resize(num_solvers);
         time_snapshots.resize(num_solvers);
-        best_solutions_snapshots.resize(num_solvers);
 
+        // Each run is processed by a task, which reads its fronts one at
+        // a time, so that at most one front per thread is in memory
         for(unsigned i = 0; i < num_solvers; i++) {
-            if(arg_parser.option_exists("--pareto-" + std::to_string(i))) {
-                ifs.open(arg_parser.option_value("--pareto-" +
-                                                 std::to_string(i)));
-
-                if(ifs.is_open()) {
-                    for(std::string line; std::getline(ifs, line);) {
-                        std::istringstream iss(line);
-                        std::vector<double> value(instance.num_objectives, 0.0);
-
-                        for(unsigned j = 0; j < instance.num_objectives; j++) {
-                            iss >> value[j];
-                        }
-
-                        paretos[i].push_back(value);
+            pool.submit([&, i]() {
+                std::ifstream ifs;
+                mofjssp::Objective_Space::Front front;
+
+                if(arg_parser.option_exists("--pareto-" + std::to_string(i))) {
+                    ifs.open(arg_parser.option_value("--pareto-" +
+                                                     std::to_string(i)));
+
+                    if(!ifs.is_open()) {
+                        throw std::runtime_error("File " +
+                                arg_parser.option_value("--pareto-" +
+                                    std::to_string(i)) + " not found.");
                     }
 
+                    front = objective_space.read_front(ifs);
                     ifs.close();
-                } else {
-                    throw std::runtime_error("File " +
-                            arg_parser.option_value("--pareto-" +
-                                std::to_string(i)) + " not found.");
                 }
-            }
-        }
 
-        for(unsigned i = 0; i < num_solvers; i++) {
-            if(arg_parser.option_exists("--best-solutions-snapshots-" +
-                                        std::to_string(i))) {
-                std::string best_solutions_snapshots_filename =
-                    arg_parser.option_value("--best-solutions-snapshots-" +
-                                            std::to_string(i));
+                normalized_igd_pluss[i] = objective_space.
+                    normalized_modified_inverted_generational_distance(front);
+
+                assert(normalized_igd_pluss[i] >= 0.0);
+                assert(normalized_igd_pluss[i] <= 1.0);
+
+                if(arg_parser.option_exists("--best-solutions-snapshots-" +
+                                            std::to_string(i))) {
+                    std::string best_solutions_snapshots_filename =
+                        arg_parser.option_value("--best-solutions-snapshots-" +
+                                                std::to_string(i));
 
-                for(unsigned j = 0; ; j++) {
-                    ifs.open(best_solutions_snapshots_filename +
-                             std::to_string(j) + ".txt");
+                    for(unsigned j = 0; ; j++) {
+                        ifs.open(best_solutions_snapshots_filename +
+                                 std::to_string(j) + ".txt");
+
+                        if(!ifs.is_open()) {
+                            break;
+                        }
 
-                    if(ifs.is_open()) {
                         unsigned iteration;
                         double time;
 
                         ifs >> iteration >> time;
+                        ifs.ignore();
 
                         iteration_snapshots[i].push_back(iteration);
                         time_snapshots[i].push_back(time);
-                        best_solutions_snapshots[i].emplace_back();
+                        front = objective_space.read_front(ifs);
+                        ifs.close();
+                        ifs.clear();
 
-                        ifs.ignore();
+                        normalized_igd_plus_snapshots[i].push_back(
+                                objective_space.
+                                    normalized_modified_inverted_generational_distance(front));
 
-                        for(std::string line; std::getline(ifs, line);) {
-                            std::istringstream iss(line);
-                            std::vector<double> value(instance.num_objectives,
-                                                      0.0);
+                        assert(normalized_igd_plus_snapshots[i].back() >= 0.0);
+                        assert(normalized_igd_plus_snapshots[i].back() <= 1.0);
+                    }
+                }
 
-                            for(unsigned j = 0;
-                                j < instance.num_objectives;
-                                j++) {
-                                iss >> value[j];
-                            }
+                if(arg_parser.option_exists("--igd-plus-" + std::to_string(i))) {
+                    std::ofstream ofs;
+                    ofs.open(arg_parser.option_value("--igd-plus-" +
+                                                     std::to_string(i)));
 
-                            best_solutions_snapshots[i].back().push_back(value);
+                    if(ofs.is_open()) {
+                        ofs << normalized_igd_pluss[i] << std::endl;
+
+                        if(ofs.eof() || ofs.fail() || ofs.bad()) {
+                            throw std::runtime_error("Error writing file " +
+                                    arg_parser.option_value("--igd-plus-" +
+                                        std::to_string(i)) + ".");
                         }
 
-                        ifs.close();
+                        ofs.close();
                     } else {
-                        break;
+                        throw std::runtime_error("File " +
+                                arg_parser.option_value("--igd-plus-" +
+                                    std::to_string(i)) + " not created.");
                     }
                 }
-            }
-        }
 
-        for(unsigned i = 0; i < num_solvers; i++) {
-            std::ofstream ofs;
-            ofs.open(arg_parser.option_value("--igd-plus-" +
-                                             std::to_string(i)));
-
-            if(ofs.is_open()) {
-                double normalized_igd_plus = normalized_modified_inverted_generational_distance(
-                        reference_igd_plus,
-                        instance.senses,
-                        reference_pareto,
-                        paretos[i]);
-
-                assert(normalized_igd_plus >= 0.0);
-                assert(normalized_igd_plus <= 1.0);
-
-                ofs << normalized_igd_plus << std::endl;
-
-                if(ofs.eof() || ofs.fail() || ofs.bad()) {
-                    throw std::runtime_error("Error writing file " +
-                            arg_parser.option_value("--igd-plus-" +
-                                std::to_string(i)) + ".");
-                }
+                if(arg_parser.option_exists("--igd-plus-snapshots-" +
+                                            std::to_string(i))) {
+                    std::ofstream ofs;
 
-                ofs.close();
-            } else {
-                throw std::runtime_error("File " +
-                        arg_parser.option_value("--igd-plus-" +
-                            std::to_string(i)) + " not created.");
-            }
-        }
+                    ofs.open(arg_parser.option_value("--igd-plus-snapshots-" +
+                                                     std::to_string(i)));
 
-        for(unsigned i = 0; i < num_solvers; i++) {
-            std::ofstream ofs;
-
-            ofs.open(arg_parser.option_value("--igd-plus-snapshots-" +
-                                             std::to_string(i)));
-
-            if(ofs.is_open()) {
-                for(unsigned j = 0;
-                    j < best_solutions_snapshots[i].size();
-                    j++) {
-                    double normalized_igd_plus = normalized_modified_inverted_generational_distance(
-                            reference_igd_plus,
-                            instance.senses,
-                            reference_pareto,
-                            best_solutions_snapshots[i][j]);
-
-                    assert(normalized_igd_plus >= 0.0);
-                    assert(normalized_igd_plus <= 1.0);
-
-                    ofs << iteration_snapshots[i][j] << ","
-                        << time_snapshots[i][j] << ","
-                        << normalized_igd_plus << std::endl;
-
-                    if(ofs.eof() || ofs.fail() || ofs.bad()) {
-                        throw std::runtime_error("Error writing file " +
-                                arg_parser.option_value(
-                                    "--igd-plus-snapshots-" +
-                                    std::to_string(i)) + ".");
+                    if(ofs.is_open()) {
+                        for(unsigned j = 0; j < normalized_igd_plus_snapshots[i].size(); j++) {
+                            ofs << iteration_snapshots[i][j] << ","
+                                << time_snapshots[i][j] << ","
+                                << normalized_igd_plus_snapshots[i][j] << std::endl;
+
+                            if(ofs.eof() || ofs.fail() || ofs.bad()) {
+                                throw std::runtime_error("Error writing file " +
+                                        arg_parser.option_value(
+                                            "--igd-plus-snapshots-" +
+                                            std::to_string(i)) + ".");
+                            }
+                        }
+
+                        ofs.close();
+                    } else {
+                        throw std::runtime_error("File " +
+                                arg_parser.option_value("--igd-plus-snapshots-" +
+                                    std::to_string(i)) + " not created.");
                     }
                 }
+            });
+        }
+
+        pool.wait();
+
+        if(arg_parser.option_exists("--results")) {
+            std::vector<Results_Store::Row> rows;
+
+            for(unsigned i = 0; i < num_solvers; i++) {
+                if(!arg_parser.option_exists("--solver-" + std::to_string(i)) ||
+                   !arg_parser.option_exists("--seed-" + std::to_string(i))) {
+                    throw std::runtime_error("The solver and the seed of run " +
+                            std::to_string(i) + " are not given.");
+                }
 
-                ofs.close();
-            } else {
-                throw std::runtime_error("File " +
-                        arg_parser.option_value("--igd-plus-snapshots-" +
-                            std::to_string(i)) + " not created.");
+                const Results_Store::Row run = {
+                    std::filesystem::path(
+                            arg_parser.option_value("--instance")).stem().string(),
+                    arg_parser.option_value("--solver-" + std::to_string(i)),
+                    unsigned(std::stoul(arg_parser.option_value(
+                                    "--seed-" + std::to_string(i)))),
+                    Results_Store::FINAL_SNAPSHOT, 0, 0.0,
+                    instance.num_jobs,
+                    instance.num_machines,
+                    instance.total_num_operations,
+                    instance.num_objectives,
+                    {}
+                };
+                const auto run_rows = Results_Store::run_rows(
+                        run,
+                        Results_Store::IGD_PLUS,
+                        normalized_igd_pluss[i],
+                        iteration_snapshots[i],
+                        time_snapshots[i],
+                        normalized_igd_plus_snapshots[i]);
+
+                rows.insert(rows.end(), run_rows.begin(), run_rows.end());
             }
+
+            Results_Store::append(arg_parser.option_value("--results"), rows);
         }
     } else {
         std::cerr << "./modified_inverted_generational_distance_exec "
                   << "--instance <instance_filename> "
                   << "--reference-pareto <reference_pareto_filename> "
+                  << "--reference-point <primal|heuristic> "
                   << "--pareto-i <pareto_filename> "
                   << "--best-solutions-snapshots-i <best_solutions_snapshots_filename> "
                   << "--igd-plus-i <modified_inverted_generational_distance_filename> "
                   << "--igd-plus-snapshots-i <modified_inverted_generational_distance_snapshots_filename> "
+                  << "--solver-i <solver> "
+                  << "--seed-i <seed> "
+                  << "--results <results_filename> "
+                  << "--num-threads <num_threads> "
                   << std::endl;
     }
 
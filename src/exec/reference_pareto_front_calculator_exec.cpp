@@ -1,6 +1,8 @@
 #include "instance/instance.hpp"
-#include "solver/solver.hpp"
+#include "solver/archive.hpp"
 #include "utils/argument_parser.hpp"
+#include "utils/thread_pool.hpp"
+#include <filesystem>
 #include <sstream>
 #include <fstream>
 
@@ -21,17 +23,21 @@ int main(int argc, char * argv[]) {
                     arg_parser.option_value("--instance") + " not found.");
         }
 
-        std::vector<std::pair<std::vector<double>, std::vector<double>>>
-                reference_pareto,
-                pareto,
-                best_solutions_snapshot;
-        unsigned num_solvers, max_num_solutions = 800;
+        std::vector<std::pair<std::string, bool>> filenames;
+        std::vector<mofjssp::Archive::Front> fronts;
+        mofjssp::Archive::Front reference_pareto;
+        unsigned num_solvers, max_num_solutions = 800,
+                 num_threads = std::thread::hardware_concurrency();
 
         if(arg_parser.option_exists("--max-num-solutions")) {
             max_num_solutions =
                 std::stoul(arg_parser.option_value("--max-num-solutions"));
         }
 
+        if(arg_parser.option_exists("--num-threads")) {
+            num_threads = std::stoul(arg_parser.option_value("--num-threads"));
+        }
+
         for(num_solvers = 0;
             arg_parser.option_exists("--pareto-" +
                                      std::to_string(num_solvers)) ||
@@ -43,36 +49,14 @@ int main(int argc, char * argv[]) {
                                      std::to_string(num_solvers));
             num_solvers++) {}
 
+        // Lists the pareto files, then the snapshot files, each with
+        // whether it starts with the iteration and time of the snapshot
         for(unsigned i = 0; i < num_solvers; i++) {
             if(arg_parser.option_exists("--pareto-" + std::to_string(i))) {
-                ifs.open(arg_parser.option_value("--pareto-" +
-                                                 std::to_string(i)));
-
-                if(ifs.is_open()) {
-                    pareto.clear();
-
-                    for(std::string line; std::getline(ifs, line);) {
-                        std::istringstream iss(line);
-                        std::vector<double> value(instance.num_objectives, 0.0);
-
-                        for(unsigned j = 0; j < instance.num_objectives; j++) {
-                            iss >> value[j];
-                        }
-
-                        pareto.push_back(std::make_pair(value, std::vector<double>()));
-                    }
-
-                    mofjssp::Solver::update_best_individuals(reference_pareto,
-                                                             pareto,
-                                                             instance.senses,
-                                                             max_num_solutions);
-
-                    ifs.close();
-                } else {
-                    throw std::runtime_error("File " +
+                filenames.push_back(std::make_pair(
                             arg_parser.option_value("--pareto-" +
-                                std::to_string(i)) + " not found.");
-                }
+                                                    std::to_string(i)),
+                            false));
             }
         }
 
@@ -83,46 +67,84 @@ int main(int argc, char * argv[]) {
                     arg_parser.option_value("--best-solutions-snapshots-" +
                                             std::to_string(i));
 
-                for(unsigned j = 0; ; j++) {
-                    ifs.open(best_solutions_snapshots_filename +
-                             std::to_string(j) + ".txt");
+                for(unsigned j = 0;
+                    std::filesystem::exists(best_solutions_snapshots_filename +
+                                            std::to_string(j) + ".txt");
+                    j++) {
+                    filenames.push_back(std::make_pair(
+                                best_solutions_snapshots_filename +
+                                std::to_string(j) + ".txt",
+                                true));
+                }
+            }
+        }
 
-                    if(ifs.is_open()) {
-                        unsigned iteration;
-                        double time;
+        // Reads the files and filters their non-dominated solutions
+        // concurrently
+        Thread_Pool pool(std::max(1u, num_threads));
 
-                        ifs >> iteration >> time;
+        fronts.resize(filenames.size());
 
-                        best_solutions_snapshot.clear();
+        for(std::size_t i = 0; i < filenames.size(); i++) {
+            pool.submit([&, i]() {
+                std::ifstream ifs;
+                mofjssp::Archive::Front pareto;
 
-                        ifs.ignore();
+                ifs.open(filenames[i].first);
 
-                        for(std::string line; std::getline(ifs, line);) {
-                            std::istringstream iss(line);
-                            std::vector<double> value(instance.num_objectives, 0.0);
+                if(!ifs.is_open()) {
+                    throw std::runtime_error("File " + filenames[i].first +
+                                             " not found.");
+                }
 
-                            for(unsigned j = 0; j < instance.num_objectives; j++) {
-                                iss >> value[j];
-                            }
+                if(filenames[i].second) {
+                    unsigned iteration;
+                    double time;
 
-                            best_solutions_snapshot.push_back(
-                                std::make_pair(value, std::vector<double>()));
-                        }
+                    ifs >> iteration >> time;
+                    ifs.ignore();
+                }
 
-                        mofjssp::Solver::update_best_individuals(
-                            reference_pareto,
-                            best_solutions_snapshot,
-                            instance.senses,
-                            max_num_solutions);
+                for(std::string line; std::getline(ifs, line);) {
+                    std::istringstream iss(line);
+                    std::vector<double> value(instance.num_objectives, 0.0);
 
-                        ifs.close();
-                    } else {
-                        break;
+                    for(unsigned j = 0; j < instance.num_objectives; j++) {
+                        iss >> value[j];
                     }
+
+                    pareto.push_back(std::make_pair(value,
+                                                    std::vector<double>()));
                 }
+
+                fronts[i] = mofjssp::Non_Dominated_Sort::first_front(
+                        pareto, instance.senses);
+            });
+        }
+
+        pool.wait();
+
+        // Merges the fronts pairwise, as a tree reduction, keeping the
+        // earlier front's solutions on ties
+        for(std::size_t step = 1; step < fronts.size(); step *= 2) {
+            for(std::size_t i = 0; i + step < fronts.size(); i += 2 * step) {
+                pool.submit([&, i, step]() {
+                    mofjssp::Archive::update(fronts[i],
+                                             fronts[i + step],
+                                             instance.senses);
+                    fronts[i + step].clear();
+                });
             }
+
+            pool.wait();
         }
 
+        if(!fronts.empty()) {
+            reference_pareto.swap(fronts.front());
+        }
+
+        mofjssp::Archive::truncate(reference_pareto, max_num_solutions);
+
         // Decrease the value of each objective function by 5%.
         for(std::pair<std::vector<double>, std::vector<double>> & solution : reference_pareto) {
             for(double & value : solution.first) {
@@ -161,6 +183,8 @@ int main(int argc, char * argv[]) {
                   << "--pareto-i <pareto_filename> "
                   << "--best-solutions-snapshots-i <best_solutions_snapshots_filename> "
                   << "--reference-pareto <reference_pareto_filename> "
+                  << "--max-num-solutions <max_num_solutions> "
+                  << "--num-threads <num_threads> "
                   << std::endl;
     }
 
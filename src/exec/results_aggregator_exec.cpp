@@ -1,11 +1,158 @@
 #include "utils/argument_parser.hpp"
+#include "utils/results_store.hpp"
 #include <algorithm>
 #include <cmath>
 #include <fstream>
+#include <iostream>
+#include <map>
 #include <numeric>
+#include <tuple>
+
+// The groups of runs whose final fronts are aggregated
+static const std::vector<std::string> groupings = {
+    "all", "instance", "jobs", "machines", "operations", "objectives"
+};
+
+// Writes the statistics of each metric of the final fronts of each
+// solver, in each group of each grouping, gathered in a single pass
+static void write_results_statistics(const Results_Store & store,
+                                     std::ostream & os) {
+    // The grouping, group, metric and solver of the runs, and the
+    // values and seeds of the runs
+    std::map<std::tuple<unsigned, std::string, unsigned, unsigned,
+                        std::string>,
+             std::vector<std::pair<double, unsigned>>> values;
+
+    for(std::size_t i = 0; i < store.size(); i++) {
+        if(store.snapshots[i] != Results_Store::FINAL_SNAPSHOT) {
+            continue;
+        }
+
+        const std::vector<std::pair<std::string, unsigned>> groups = {
+            {"all", 0},
+            {store.instances[i], 0},
+            {"", store.num_jobs[i]},
+            {"", store.num_machines[i]},
+            {"", store.num_operations[i]},
+            {"", store.num_objectives[i]}
+        };
+
+        for(unsigned metric = 0;
+            metric < Results_Store::NUM_METRICS;
+            metric++) {
+            if(std::isnan(store.metrics[metric][i])) {
+                continue;
+            }
+
+            for(unsigned grouping = 0; grouping < groupings.size(); grouping++) {
+                values[std::make_tuple(grouping,
+                                       groups[grouping].first,
+                                       groups[grouping].second,
+                                       metric,
+                                       store.solvers[i])].push_back(
+                        std::make_pair(store.metrics[metric][i],
+                                       store.seeds[i]));
+            }
+        }
+    }
+
+    os << "grouping,group,solver,metric,count,mean,std,median,best,"
+       << "best_seed,median_seed,rank" << std::endl;
+
+    for(auto it = values.begin(); it != values.end();) {
+        // The solvers of the same group and metric, which are ranked
+        auto end = it;
+        std::vector<double> means;
+
+        for(; end != values.end() &&
+              std::get<0>(end->first) == std::get<0>(it->first) &&
+              std::get<1>(end->first) == std::get<1>(it->first) &&
+              std::get<2>(end->first) == std::get<2>(it->first) &&
+              std::get<3>(end->first) == std::get<3>(it->first);
+            end++) {
+            means.push_back(std::accumulate(end->second.begin(),
+                    end->second.end(), 0.0,
+                    [](double sum, const std::pair<double, unsigned> & run) {
+                        return sum + run.first;
+                    }) / end->second.size());
+        }
+
+        for(unsigned k = 0; it != end; it++, k++) {
+            const unsigned grouping = std::get<0>(it->first);
+            const auto metric =
+                Results_Store::Metric(std::get<3>(it->first));
+            const bool is_maximized = Results_Store::is_maximized(metric);
+            std::vector<std::pair<double, unsigned>> & runs = it->second;
+            double variance = 0.0;
+            unsigned rank = 1;
+
+            std::sort(runs.begin(), runs.end());
+
+            for(const auto & run : runs) {
+                variance += (run.first - means[k]) * (run.first - means[k]);
+            }
+
+            for(double mean : means) {
+                if(is_maximized ? mean > means[k] : mean < means[k]) {
+                    rank++;
+                }
+            }
+
+            const auto & best = is_maximized ? runs.back() : runs.front();
+            const double median = runs.size() % 2 == 1 ?
+                runs[runs.size() / 2].first :
+                (runs[runs.size() / 2 - 1].first +
+                 runs[runs.size() / 2].first) / 2.0;
+
+            os << groupings[grouping] << ",";
+
+            if(grouping <= 1) {
+                os << std::get<1>(it->first);
+            } else {
+                os << std::get<2>(it->first);
+            }
+
+            os << "," << std::get<4>(it->first) << ","
+               << Results_Store::name(metric) << "," << runs.size() << ","
+               << means[k] << "," << std::sqrt(variance / runs.size()) << ","
+               << median << "," << best.first << "," << best.second << ","
+               << runs[runs.size() / 2].second << "," << rank << std::endl;
+        }
+    }
+}
 
 int main(int argc, char * argv[]) {
     Argument_Parser arg_parser(argc, argv);
+
+    if(arg_parser.option_exists("--results")) {
+        const Results_Store store =
+            Results_Store::load(arg_parser.option_value("--results"));
+
+        if(arg_parser.option_exists("--results-statistics")) {
+            std::ofstream ofs;
+            ofs.open(arg_parser.option_value("--results-statistics"));
+
+            if(ofs.is_open()) {
+                write_results_statistics(store, ofs);
+
+                if(ofs.eof() || ofs.fail() || ofs.bad()) {
+                    throw std::runtime_error("Error writing file " +
+                            arg_parser.option_value("--results-statistics") +
+                            ".");
+                }
+
+                ofs.close();
+            } else {
+                throw std::runtime_error("File " +
+                        arg_parser.option_value("--results-statistics") +
+                        " not created.");
+            }
+        } else {
+            write_results_statistics(store, std::cout);
+        }
+
+        return 0;
+    }
     std::vector<double> hypervolume_values, igd_plus_values, multiplicative_epsilon_values;
 
     unsigned num_hypervolumes, index_best, index_median, num_igd_pluses, num_multiplicative_epsilons;
@@ -22,7 +169,7 @@ int main(int argc, char * argv[]) {
         num_igd_pluses++) {}
     
     for(num_multiplicative_epsilons = 0;
-        arg_parser.option_exists("--igd-plus-" +
+        arg_parser.option_exists("--multiplicative-epsilon-" +
                                  std::to_string(num_multiplicative_epsilons));
         num_multiplicative_epsilons++) {}
 
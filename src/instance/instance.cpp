@@ -1,6 +1,9 @@
 #include "instance/instance.hpp"
 #include <algorithm>
+#include <fstream>
 #include <limits>
+#include <mutex>
+#include <stdexcept>
 
 namespace mofjssp {
 
@@ -27,54 +30,153 @@ void Instance::compute_primal_bound() {
     }
 }
 
-Instance::Instance(const std::map<std::tuple<unsigned, unsigned, unsigned>, double> & processing_time) : 
-        processing_time(processing_time),
+void Instance::compute_heuristic_bound() {
+    std::vector<unsigned> next_operation(this->num_jobs, 0);
+    std::vector<double> job_ready_time(this->num_jobs, 0.0),
+                        machine_ready_time(this->num_machines, 0.0),
+                        working_time(this->num_machines, 0.0);
+
+    this->heuristic_bound.assign(this->num_objectives, 0.0);
+
+    for (unsigned i = 0; i < this->total_num_operations; i++) {
+        unsigned best_job = this->num_jobs, best_machine = this->num_machines;
+        double best_completion_time = std::numeric_limits<double>::max();
+
+        for (unsigned job = 0; job < this->num_jobs; job++) {
+            if (next_operation[job] == this->num_operations[job]) {
+                continue;
+            }
+
+            for (unsigned machine :
+                    this->machines_of_operation[job][next_operation[job]]) {
+                const double completion_time =
+                    std::max(job_ready_time[job], machine_ready_time[machine]) +
+                    this->processing_time.at(std::make_tuple(
+                                job, next_operation[job], machine));
+
+                // The ties are broken by the least job, then machine
+                if (completion_time < best_completion_time ||
+                        (completion_time == best_completion_time &&
+                         job == best_job && machine < best_machine)) {
+                    best_job = job;
+                    best_machine = machine;
+                    best_completion_time = completion_time;
+                }
+            }
+        }
+
+        // Only if an operation has no machine
+        if (best_job == this->num_jobs) {
+            return;
+        }
+
+        working_time[best_machine] += this->processing_time.at(std::make_tuple(
+                    best_job, next_operation[best_job], best_machine));
+        job_ready_time[best_job] = best_completion_time;
+        machine_ready_time[best_machine] = best_completion_time;
+        next_operation[best_job]++;
+    }
+
+    for (unsigned job = 0; job < this->num_jobs; job++) {
+        this->heuristic_bound[0] = std::max(this->heuristic_bound[0],
+                                            job_ready_time[job]);
+        this->heuristic_bound[1] += job_ready_time[job];
+    }
+
+    for (unsigned machine = 0; machine < this->num_machines; machine++) {
+        this->heuristic_bound[2] = std::max(this->heuristic_bound[2],
+                                            working_time[machine]);
+        this->heuristic_bound[3] += working_time[machine];
+    }
+}
+
+void Instance::compute_lower_bound() {
+    double max_processing_time = 0.0;
+
+    this->lower_bound.assign(this->num_objectives, 0.0);
+
+    for (unsigned job = 0; job < this->num_jobs; job++) {
+        // The least time in which the operations of the job are processed
+        double job_time = 0.0;
+
+        for (unsigned operation = 0;
+             operation < this->num_operations[job];
+             operation++) {
+            double processing_time = std::numeric_limits<double>::max();
+
+            for (unsigned machine :
+                    this->machines_of_operation[job][operation]) {
+                processing_time = std::min(processing_time,
+                        this->processing_time.at(std::make_tuple(
+                                job, operation, machine)));
+            }
+
+            if (this->machines_of_operation[job][operation].empty()) {
+                processing_time = 0.0;
+            }
+
+            job_time += processing_time;
+            max_processing_time = std::max(max_processing_time,
+                                           processing_time);
+        }
+
+        this->lower_bound[0] = std::max(this->lower_bound[0], job_time);
+        this->lower_bound[1] += job_time;
+        this->lower_bound[3] += job_time;
+    }
+
+    // Some machine works at least the mean of the least total workload,
+    // and within the makespan
+    this->lower_bound[2] = std::max(max_processing_time,
+                                    this->lower_bound[3] / this->num_machines);
+    this->lower_bound[0] = std::max(this->lower_bound[0],
+                                    this->lower_bound[2]);
+}
+
+Reference_Point parse_reference_point(const std::string & reference_point) {
+    if (reference_point == "primal") {
+        return Reference_Point::PRIMAL_BOUND;
+    } else if (reference_point == "heuristic") {
+        return Reference_Point::HEURISTIC_BOUND;
+    }
+
+    throw std::invalid_argument("Invalid reference point " + reference_point +
+                                ".");
+}
+
+Instance::Instance(std::map<std::tuple<unsigned, unsigned, unsigned>, double> processing_time) : 
+        processing_time(std::move(processing_time)),
+        num_jobs(0),
+        total_num_operations(0),
+        num_machines(0),
         num_objectives(4),
         senses(4, NSBRKGA::Sense::MINIMIZE),
         primal_bound(num_objectives, 0.0) {
-    std::vector<unsigned> jobs;
-    std::vector<std::vector<unsigned>> operations;
-    std::vector<unsigned> machines;
-
+    // The jobs, operations and machines are indexed from zero, so their
+    // numbers are one past the largest index of each (machines that do
+    // not process any operation past the last used one are not counted)
     for (const auto & [key, value] : this->processing_time) {
         const unsigned job = std::get<0>(key),
+                       operation = std::get<1>(key),
                        machine = std::get<2>(key);
 
-        jobs.push_back(job);
-        machines.push_back(machine);
-    }
+        this->num_jobs = std::max(this->num_jobs, job + 1);
+        this->num_machines = std::max(this->num_machines, machine + 1);
 
-    this->num_jobs = jobs.size();
-    this->num_machines = machines.size();
-    this->num_operations.resize(this->num_jobs, 0);
-    this->num_operations.assign(this->num_jobs, 0);
-    this->total_num_operations = 0;
-    this->machines_of_operation.resize(this->num_jobs,
-                                       std::vector<std::vector<unsigned>>());
-    this->machines_of_operation.assign(this->num_jobs,
-                                       std::vector<std::vector<unsigned>>());
-    this->operations_of_machine.resize(this->num_machines,
-                                       std::vector<std::pair<unsigned, unsigned>>());
-    this->operations_of_machine.assign(this->num_machines,
-                                       std::vector<std::pair<unsigned, unsigned>>());
-
-    operations.resize(jobs.size(), std::vector<unsigned>());
-    operations.assign(jobs.size(), std::vector<unsigned>());
-
-    for (const auto & [key, value] : this->processing_time) {
-        const unsigned job = std::get<0>(key),
-                       operation = std::get<1>(key);
+        if (this->num_operations.size() < this->num_jobs) {
+            this->num_operations.resize(this->num_jobs, 0);
+        }
 
-        operations[job].push_back(operation);
+        this->num_operations[job] = std::max(this->num_operations[job],
+                                             operation + 1);
     }
 
-    for (unsigned job : jobs) {
-        this->num_operations[job] = operations[job].size();
+    this->machines_of_operation.resize(this->num_jobs);
+    this->operations_of_machine.resize(this->num_machines);
+
+    for (unsigned job = 0; job < this->num_jobs; job++) {
         this->total_num_operations += this->num_operations[job];
-        this->machines_of_operation[job].resize(this->num_operations[job],
-                                                std::vector<unsigned>());
-        this->machines_of_operation[job].assign(this->num_operations[job],
-                                                std::vector<unsigned>());
+        this->machines_of_operation[job].resize(this->num_operations[job]);
     }
 
     for (const auto & [key, value] : this->processing_time) {
@@ -88,25 +190,56 @@ Instance::Instance(const std::map<std::tuple<unsigned, unsigned, unsigned>, doub
     }
 
     this->compute_primal_bound();
+    this->compute_heuristic_bound();
+    this->compute_lower_bound();
 }
 
 Instance::Instance(const Instance & instance) = default;
 
+Instance::Instance(Instance && instance) = default;
+
 Instance::Instance() = default;
 
-Instance Instance::operator = (const Instance & instance) {
-    this->processing_time = instance.processing_time;
-    this->num_jobs = instance.num_jobs;
-    this->num_machines = instance.num_machines;
-    this->num_operations = instance.num_operations;
-    this->total_num_operations = instance.total_num_operations;
-    this->machines_of_operation = instance.machines_of_operation;
-    this->operations_of_machine = instance.operations_of_machine;
-    this->processing_time = instance.processing_time;
-    this->num_objectives = 4;
-    this->senses = std::vector<NSBRKGA::Sense>(this->num_objectives, NSBRKGA::Sense::MINIMIZE);
-    this->primal_bound = instance.primal_bound;
-    return *this;
+Instance & Instance::operator = (const Instance & instance) = default;
+
+Instance & Instance::operator = (Instance && instance) = default;
+
+std::shared_ptr<const Instance> Instance::load(const std::string & filename) {
+    static std::mutex mutex;
+    static std::map<std::string, std::shared_ptr<const Instance>> instances;
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (instances.count(filename) == 0) {
+        std::ifstream ifs;
+        auto instance = std::make_shared<Instance>();
+
+        ifs.open(filename);
+
+        if (!ifs.is_open()) {
+            throw std::runtime_error("File " + filename + " not found.");
+        }
+
+        ifs >> *instance;
+
+        if (ifs.eof() || ifs.fail() || ifs.bad()) {
+            throw std::runtime_error("Error reading file " + filename + ".");
+        }
+
+        ifs.close();
+
+        instances[filename] = std::move(instance);
+    }
+
+    return instances.at(filename);
+}
+
+const std::vector<double> & Instance::reference_point(
+        Reference_Point reference_point) const {
+    if (reference_point == Reference_Point::HEURISTIC_BOUND) {
+        return this->heuristic_bound;
+    }
+
+    return this->primal_bound;
 }
 
 bool Instance::is_valid() const {
@@ -224,6 +357,18 @@ bool Instance::is_valid() const {
         }
     }
 
+    if (this->heuristic_bound.size() != this->num_objectives ||
+            this->lower_bound.size() != this->num_objectives) {
+        return false;
+    }
+
+    for (unsigned i = 0; i < this->num_objectives; i++) {
+        if (this->lower_bound[i] > this->heuristic_bound[i] ||
+                this->heuristic_bound[i] > this->primal_bound[i]) {
+            return false;
+        }
+    }
+
     return true;
 }
 
@@ -273,6 +418,8 @@ std::istream & operator >>(std::istream & is, Instance & instance) {
     }
 
     instance.compute_primal_bound();
+    instance.compute_heuristic_bound();
+    instance.compute_lower_bound();
 
     return is;
 }
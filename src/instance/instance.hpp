@@ -6,10 +6,36 @@
 #include <istream>
 #include <ostream>
 #include <map>
+#include <memory>
+#include <string>
 #include <tuple>
 #include <vector>
 
 namespace mofjssp {
+/*********************************************************************
+ * The points that may be taken as the reference point of the
+ * indicators: the primal bound, which no solution exceeds, or the
+ * heuristic bound, i.e., the value of a constructive schedule, which
+ * bounds a much smaller box around the fronts found. The heuristic
+ * bound is not an upper bound of the fronts, so the calculators widen
+ * it past the nadir point of the reference front.
+ *********************************************************************/
+enum class Reference_Point {
+    PRIMAL_BOUND,
+    HEURISTIC_BOUND
+};
+
+/*********************************************************************
+ * Parses a reference point, i.e., "primal" or "heuristic".
+ *
+ * @param reference_point the name of the reference point.
+ *
+ * @return the reference point.
+ *
+ * @throw std::invalid_argument if the name is not a reference point.
+ *********************************************************************/
+Reference_Point parse_reference_point(const std::string & reference_point);
+
 /********************************************************
  * The Instance class represents an instance of the 
  * Multi-Objective Flexible Job Shop Scheduling Problem.
@@ -66,19 +92,42 @@ class Instance {
      ********************************/
     std::vector<double> primal_bound;
 
+    /*****************************************************************
+     * The value of the schedule built by assigning, one at a time, the
+     * next operation of some job to the machine on which it completes
+     * the earliest, among those of every job.
+     *****************************************************************/
+    std::vector<double> heuristic_bound;
+
+    /*****************************************************************
+     * A lower bound on each objective, from the sum of the least
+     * processing times of the operations of each job and of all jobs.
+     *****************************************************************/
+    std::vector<double> lower_bound;
+
     private:
     /*********************************************
      * Computes the primal bounds of the instance.
      *********************************************/
     void compute_primal_bound();
 
+    /************************************************
+     * Computes the heuristic bound of the instance.
+     ************************************************/
+    void compute_heuristic_bound();
+
+    /*********************************************
+     * Computes the lower bound of the instance.
+     *********************************************/
+    void compute_lower_bound();
+
     public:
     /*********************************************************************************************
-     * Constructs a new instance.
+     * Constructs a new instance, taking over the processing times.
      *
      * @param processing_time The processing time of each operation of each job in each machine.
      *********************************************************************************************/
-    Instance(const std::map<std::tuple<unsigned, unsigned, unsigned>, double> & processing_time);
+    Instance(std::map<std::tuple<unsigned, unsigned, unsigned>, double> processing_time);
 
     /*********************************************
      * Copy constructor.
@@ -87,6 +136,13 @@ class Instance {
      ********************************************/
     Instance(const Instance & instance);
 
+    /*********************************************
+     * Move constructor.
+     *
+     * @param instance the instance been moved.
+     ********************************************/
+    Instance(Instance && instance);
+
     /********************************
      * Constructs an empty instance.
      ********************************/
@@ -99,7 +155,36 @@ class Instance {
      *
      * @return this instance
      ************************************************/
-    Instance operator = (const Instance & instance);
+    Instance & operator = (const Instance & instance);
+
+    /************************************************
+     * Move assignment operator.
+     *
+     * @param instance the instance been moved.
+     *
+     * @return this instance
+     ************************************************/
+    Instance & operator = (Instance && instance);
+
+    /***********************************************************************
+     * Loads an instance from a file. Each file is read only once per
+     * process, and the same read-only instance is shared by all callers.
+     *
+     * @param filename the name of the instance file.
+     *
+     * @return the instance.
+     ***********************************************************************/
+    static std::shared_ptr<const Instance> load(const std::string & filename);
+
+    /*****************************************************
+     * Returns a reference point of the indicators.
+     *
+     * @param reference_point the reference point.
+     *
+     * @return the bound taken as the reference point.
+     *****************************************************/
+    const std::vector<double> & reference_point(
+            Reference_Point reference_point) const;
 
     /***********************************************************
      * Verifies whether this instance is valid.
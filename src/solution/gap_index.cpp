@@ -0,0 +1,207 @@
+#include "solution/gap_index.hpp"
+#include <algorithm>
+
+namespace mofjssp {
+
+void Gap_Index::update(unsigned node) {
+    Node & n = this->nodes[node];
+
+    n.max_length = n.end - n.start;
+
+    if (n.left != none) {
+        n.max_length = std::max(n.max_length,
+                                this->nodes[n.left].max_length);
+    }
+
+    if (n.right != none) {
+        n.max_length = std::max(n.max_length,
+                                this->nodes[n.right].max_length);
+    }
+}
+
+void Gap_Index::split(unsigned node,
+                      double time,
+                      unsigned & left,
+                      unsigned & right) {
+    if (node == none) {
+        left = right = none;
+    } else if (this->nodes[node].start < time) {
+        this->split(this->nodes[node].right, time,
+                    this->nodes[node].right, right);
+        left = node;
+        this->update(node);
+    } else {
+        this->split(this->nodes[node].left, time,
+                    left, this->nodes[node].left);
+        right = node;
+        this->update(node);
+    }
+}
+
+unsigned Gap_Index::merge(unsigned left, unsigned right) {
+    if (left == none) {
+        return right;
+    }
+
+    if (right == none) {
+        return left;
+    }
+
+    if (this->nodes[left].priority > this->nodes[right].priority) {
+        this->nodes[left].right = this->merge(this->nodes[left].right, right);
+        this->update(left);
+
+        return left;
+    }
+
+    this->nodes[right].left = this->merge(left, this->nodes[right].left);
+    this->update(right);
+
+    return right;
+}
+
+unsigned Gap_Index::first_fit(unsigned node,
+                              double time,
+                              double length) const {
+    if (node == none || this->nodes[node].max_length < length) {
+        return none;
+    }
+
+    const Node & n = this->nodes[node];
+
+    if (n.start < time) {
+        return this->first_fit(n.right, time, length);
+    }
+
+    // Only the subtrees on the path of the time may be left without
+    // finding an interval, so the search visits O(log n) nodes
+    const unsigned left = this->first_fit(n.left, time, length);
+
+    if (left != none) {
+        return left;
+    }
+
+    if (n.end - n.start >= length) {
+        return node;
+    }
+
+    return this->first_fit(n.right, time, length);
+}
+
+unsigned Gap_Index::last_before(double time) const {
+    unsigned node = this->root,
+             result = none;
+
+    while (node != none) {
+        if (this->nodes[node].start <= time) {
+            result = node;
+            node = this->nodes[node].right;
+        } else {
+            node = this->nodes[node].left;
+        }
+    }
+
+    return result;
+}
+
+void Gap_Index::add(double start, double end) {
+    unsigned node, left, right;
+
+    // A xorshift generator, so that the schedules are deterministic
+    this->seed ^= this->seed << 13;
+    this->seed ^= this->seed >> 17;
+    this->seed ^= this->seed << 5;
+
+    if (this->free_nodes.empty()) {
+        node = this->nodes.size();
+        this->nodes.emplace_back();
+    } else {
+        node = this->free_nodes.back();
+        this->free_nodes.pop_back();
+    }
+
+    this->nodes[node] = Node{start, end, end - start, this->seed, none, none};
+
+    this->split(this->root, start, left, right);
+    this->root = this->merge(this->merge(left, node), right);
+}
+
+unsigned Gap_Index::remove(unsigned node, double start) {
+    Node & n = this->nodes[node];
+
+    if (n.start == start) {
+        this->free_nodes.push_back(node);
+
+        return this->merge(n.left, n.right);
+    }
+
+    if (start < n.start) {
+        n.left = this->remove(n.left, start);
+    } else {
+        n.right = this->remove(n.right, start);
+    }
+
+    this->update(node);
+
+    return node;
+}
+
+void Gap_Index::clear() {
+    this->nodes.clear();
+    this->free_nodes.clear();
+    this->root = none;
+    this->end = 0.0;
+}
+
+std::size_t Gap_Index::size() const {
+    return this->nodes.size() - this->free_nodes.size();
+}
+
+double Gap_Index::insert(double release_time, double processing_time) {
+    double starting_time = std::max(release_time, this->end);
+
+    if (release_time + processing_time < this->end &&
+            this->root != none &&
+            processing_time <= this->nodes[this->root].max_length) {
+        // The interval containing the release time, or else the
+        // earliest long enough interval starting after it
+        unsigned gap = this->last_before(release_time);
+        double start = release_time;
+
+        if (gap == none ||
+                this->nodes[gap].end - release_time < processing_time) {
+            gap = this->first_fit(this->root, release_time, processing_time);
+
+            if (gap != none) {
+                start = this->nodes[gap].start;
+            }
+        }
+
+        if (gap != none) {
+            const double gap_start = this->nodes[gap].start,
+                         gap_end = this->nodes[gap].end;
+
+            this->root = this->remove(this->root, gap_start);
+
+            if (gap_start < start) {
+                this->add(gap_start, start);
+            }
+
+            if (start + processing_time < gap_end) {
+                this->add(start + processing_time, gap_end);
+            }
+
+            return start;
+        }
+    }
+
+    if (this->end < starting_time) {
+        this->add(this->end, starting_time);
+    }
+
+    this->end = starting_time + processing_time;
+
+    return starting_time;
+}
+
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+
+namespace mofjssp {
+/*******************************************************************
+ * The Gap_Index class represents the idle intervals of a machine,
+ * sorted by their starting times, used to insert each operation in
+ * the earliest interval where it fits (active scheduling).
+ *
+ * The intervals are kept in a treap keyed by their starting times,
+ * each node holding the length of the longest interval of its
+ * subtree, so that the earliest interval where an operation fits
+ * is found, and split, in O(log n) expected time.
+ *******************************************************************/
+class Gap_Index {
+    private:
+    /*****************************************************************
+     * An idle interval, the length of the longest interval of its
+     * subtree, its priority and its children.
+     *****************************************************************/
+    struct Node {
+        double start;
+        double end;
+        double max_length;
+        unsigned priority;
+        unsigned left;
+        unsigned right;
+    };
+
+    /*******************************************
+     * Marks the absence of a node.
+     *******************************************/
+    static constexpr unsigned none = std::numeric_limits<unsigned>::max();
+
+    /*****************************************************************
+     * The nodes, the nodes of the erased intervals to be reused, and
+     * the root of the treap.
+     *****************************************************************/
+    std::vector<Node> nodes;
+
+    std::vector<unsigned> free_nodes;
+
+    unsigned root = none;
+
+    /*********************************************
+     * The state of the generator of priorities.
+     *********************************************/
+    unsigned seed = 2463534242u;
+
+    /*****************************************************************
+     * Recomputes the length of the longest interval of a subtree.
+     *****************************************************************/
+    void update(unsigned node);
+
+    /*****************************************************************
+     * Splits a subtree into the intervals starting before a time and
+     * those starting at or after it.
+     *
+     * @param node  the root of the subtree.
+     * @param time  the time.
+     * @param left  the root of the intervals starting before the time.
+     * @param right the root of the other intervals.
+     *****************************************************************/
+    void split(unsigned node, double time, unsigned & left, unsigned & right);
+
+    /*****************************************************************
+     * Merges two subtrees, the intervals of the first starting before
+     * those of the second.
+     *
+     * @return the root of the merged subtree.
+     *****************************************************************/
+    unsigned merge(unsigned left, unsigned right);
+
+    /*****************************************************************
+     * Returns the earliest interval of a subtree starting at or after
+     * a time whose length is at least a given length, if any.
+     *****************************************************************/
+    unsigned first_fit(unsigned node, double time, double length) const;
+
+    /*****************************************************************
+     * Returns the latest interval starting at or before a time, if
+     * any.
+     *****************************************************************/
+    unsigned last_before(double time) const;
+
+    /*************************************************
+     * Adds an idle interval.
+     *************************************************/
+    void add(double start, double end);
+
+    /*****************************************************************
+     * Removes the idle interval starting at a time from a subtree.
+     *
+     * @return the root of the subtree.
+     *****************************************************************/
+    unsigned remove(unsigned node, double start);
+
+    public:
+    /*******************************************************
+     * The time when the last operation of the machine ends.
+     *******************************************************/
+    double end = 0.0;
+
+    /****************************************
+     * Removes all operations of the machine.
+     ****************************************/
+    void clear();
+
+    /**************************************
+     * Returns the number of idle intervals.
+     **************************************/
+    std::size_t size() const;
+
+    /*******************************************************************
+     * Inserts an operation in the earliest idle interval where it fits,
+     * or after the last operation of the machine.
+     *
+     * @param release_time    the time when the operation can start.
+     * @param processing_time the processing time of the operation.
+     *
+     * @return the starting time of the operation.
+     *******************************************************************/
+    double insert(double release_time, double processing_time);
+};
+
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace mofjssp {
+/*********************************************************************
+ * The precision in which the alleles of the keys are represented.
+ * The decoder only compares alleles with the thresholds of the
+ * machines and with each other, so keys quantized to 32-bit floats
+ * or to 16-bit fixed-point numbers in [0, 1] decode to the same
+ * schedules for realistic instance sizes. The alleles are quantized
+ * as they are read, and only the keys of a Population_Matrix are
+ * stored in the narrower precision; the populations, the best
+ * individuals and the archive keep doubles holding quantized values.
+ *********************************************************************/
+enum class Key_Precision {
+    DOUBLE,
+    FLOAT,
+    FIXED16
+};
+
+/*********************************************************
+ * The largest 16-bit fixed-point allele, representing 1.
+ *********************************************************/
+constexpr double max_fixed16_allele = 65535.0;
+
+/*****************************************************************
+ * Returns the number of bytes of an allele in a given precision.
+ *
+ * @param precision the precision.
+ *
+ * @return the number of bytes of an allele.
+ *****************************************************************/
+inline std::size_t size_of_allele(Key_Precision precision) {
+    switch (precision) {
+        case Key_Precision::FLOAT:
+            return sizeof(float);
+        case Key_Precision::FIXED16:
+            return sizeof(std::uint16_t);
+        default:
+            return sizeof(double);
+    }
+}
+
+/*********************************************************************
+ * Encodes an allele as a 16-bit fixed-point number.
+ *
+ * @param allele the allele, in [0, 1].
+ *
+ * @return the fixed-point allele.
+ *********************************************************************/
+inline std::uint16_t to_fixed16(double allele) {
+    return std::uint16_t(std::lround(std::clamp(allele, 0.0, 1.0) *
+                                     max_fixed16_allele));
+}
+
+/*********************************************************************
+ * Returns the value of an allele represented in a given precision,
+ * which is the allele itself if it is already represented in it.
+ *
+ * @param allele    the allele.
+ * @param precision the precision.
+ *
+ * @return the quantized allele.
+ *********************************************************************/
+inline double quantize(double allele, Key_Precision precision) {
+    switch (precision) {
+        case Key_Precision::FLOAT:
+            return double(float(allele));
+        case Key_Precision::FIXED16:
+            return double(to_fixed16(allele)) / max_fixed16_allele;
+        default:
+            return allele;
+    }
+}
+
+/*********************************************************************
+ * Returns the index of the machine, among the eligible machines of an
+ * operation, that an allele selects, i.e., the index of the interval
+ * [k / n, (k + 1) / n) that contains it. The decoders and the
+ * solutions select machines by this single rule, so that a key, in
+ * particular a quantized one whose alleles may lie exactly on the
+ * bounds of the intervals, decodes to the same machines in both.
+ *
+ * @param allele       the allele, in [0, 1].
+ * @param num_machines the number of eligible machines.
+ *
+ * @return the index of the machine.
+ *********************************************************************/
+inline unsigned machine_index(double allele, std::size_t num_machines) {
+    return unsigned(std::min(
+                std::size_t(std::max(0.0, std::floor(allele * num_machines))),
+                num_machines - 1));
+}
+
+/*****************************************************************
+ * Quantizes the alleles of a key.
+ *
+ * @param key       the key.
+ * @param precision the precision.
+ *****************************************************************/
+inline void quantize(std::vector<double> & key, Key_Precision precision) {
+    if (precision != Key_Precision::DOUBLE) {
+        for (double & allele : key) {
+            allele = quantize(allele, precision);
+        }
+    }
+}
+
+/*****************************************************************
+ * Parses a precision ("double", "float" or "fixed16").
+ *
+ * @param name the name of the precision.
+ *
+ * @return the precision.
+ *****************************************************************/
+inline Key_Precision parse_key_precision(const std::string & name) {
+    if (name == "double") {
+        return Key_Precision::DOUBLE;
+    } else if (name == "float") {
+        return Key_Precision::FLOAT;
+    } else if (name == "fixed16") {
+        return Key_Precision::FIXED16;
+    }
+
+    throw std::invalid_argument("Invalid key precision " + name + ".");
+}
+
+/*****************************************************************
+ * Returns the name of a precision.
+ *
+ * @param precision the precision.
+ *
+ * @return the name of the precision.
+ *****************************************************************/
+inline std::string to_string(Key_Precision precision) {
+    switch (precision) {
+        case Key_Precision::FLOAT:
+            return "float";
+        case Key_Precision::FIXED16:
+            return "fixed16";
+        default:
+            return "double";
+    }
+}
+
+}
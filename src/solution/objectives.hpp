@@ -0,0 +1,131 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace mofjssp {
+/*********************************************************************
+ * The objective values of a solution, whose number is fixed at
+ * compile time, so that they are kept inline instead of on the heap.
+ *********************************************************************/
+template <std::size_t N = 4>
+using Objectives = std::array<double, N>;
+
+/*********************************************************************
+ * The bit of each objective in a set of objectives, so that only the
+ * objectives an algorithm needs are computed.
+ *********************************************************************/
+enum Objective : unsigned {
+    MAKESPAN = 1u << 0,
+    TOTAL_COMPLETION_TIME = 1u << 1,
+    MAXIMAL_WORKLOAD = 1u << 2,
+    TOTAL_WORKLOAD = 1u << 3,
+    ALL_OBJECTIVES = (1u << 4) - 1
+};
+
+/********************************************************************
+ * Returns the set of objectives with a nonzero weight in a weighted
+ * scalarization, such as a decomposition of MOEA/D.
+ *
+ * @param weights the weight of each objective.
+ *
+ * @return the objectives with a nonzero weight.
+ ********************************************************************/
+inline unsigned objectives_of_weights(const std::vector<double> & weights) {
+    unsigned objectives = 0;
+
+    for (std::size_t i = 0; i < weights.size(); i++) {
+        if (weights[i] != 0.0) {
+            objectives |= 1u << i;
+        }
+    }
+
+    return objectives;
+}
+
+/********************************************************************
+ * Returns true if the N values of valueA dominate the N values of
+ * valueB, i.e., if none is greater and one is smaller (with a
+ * tolerance of epsilon); false otherwise.
+ *
+ * @param valueA the first values been compared.
+ * @param valueB the second values been compared.
+ *
+ * @return true if valueA dominates valueB; false otherwise.
+ ********************************************************************/
+template <std::size_t N>
+inline bool dominates(const double * valueA, const double * valueB) {
+    bool at_least_as_good = true, better = false;
+
+    for (std::size_t i = 0; i < N; i++) {
+        at_least_as_good &= valueA[i] <=
+            valueB[i] + std::numeric_limits<double>::epsilon();
+        better |= valueA[i] <
+            valueB[i] - std::numeric_limits<double>::epsilon();
+    }
+
+    return at_least_as_good && better;
+}
+
+#if defined(__AVX__)
+/***********************************************************
+ * Four objectives are compared at once in an AVX register.
+ ***********************************************************/
+template <>
+inline bool dominates<4>(const double * valueA, const double * valueB) {
+    const __m256d a = _mm256_loadu_pd(valueA),
+                  b = _mm256_loadu_pd(valueB),
+                  epsilon = _mm256_set1_pd(
+                          std::numeric_limits<double>::epsilon());
+    const int worse = _mm256_movemask_pd(_mm256_cmp_pd(
+                a, _mm256_add_pd(b, epsilon), _CMP_GT_OQ)),
+              better = _mm256_movemask_pd(_mm256_cmp_pd(
+                a, _mm256_sub_pd(b, epsilon), _CMP_LT_OQ));
+
+    return worse == 0 && better != 0;
+}
+#elif defined(__SSE2__)
+/***************************************************************
+ * Four objectives are compared in two SSE2 registers.
+ ***************************************************************/
+template <>
+inline bool dominates<4>(const double * valueA, const double * valueB) {
+    const __m128d epsilon = _mm_set1_pd(std::numeric_limits<double>::epsilon()),
+                  a0 = _mm_loadu_pd(valueA),
+                  a1 = _mm_loadu_pd(valueA + 2),
+                  b0 = _mm_loadu_pd(valueB),
+                  b1 = _mm_loadu_pd(valueB + 2);
+    const int worse = _mm_movemask_pd(_mm_or_pd(
+                _mm_cmpgt_pd(a0, _mm_add_pd(b0, epsilon)),
+                _mm_cmpgt_pd(a1, _mm_add_pd(b1, epsilon)))),
+              better = _mm_movemask_pd(_mm_or_pd(
+                _mm_cmplt_pd(a0, _mm_sub_pd(b0, epsilon)),
+                _mm_cmplt_pd(a1, _mm_sub_pd(b1, epsilon))));
+
+    return worse == 0 && better != 0;
+}
+#endif
+
+/********************************************************************
+ * Returns true if valueA dominates valueB; false otherwise.
+ *
+ * @param valueA the first value been compared.
+ * @param valueB the second value been compared.
+ *
+ * @return true if valueA dominates valueB; false otherwise.
+ ********************************************************************/
+template <std::size_t N>
+inline bool dominates(const Objectives<N> & valueA,
+                      const Objectives<N> & valueB) {
+    return dominates<N>(valueA.data(), valueB.data());
+}
+
+}
@@ -11,17 +11,12 @@ bool Solution::dominates(const std::vector<double> & valueA,
         return false;
     }
 
-    bool at_least_as_good = true, better = false;
-
-    for (std::size_t i = 0; i < valueA.size(); i++) {
-        if (valueA[i] > valueB[i] + std::numeric_limits<double>::epsilon()) {
-            at_least_as_good = false;
-        } else  if (valueA[i] < valueB[i] - std::numeric_limits<double>::epsilon()) {
-            better = true;
-        }
-    }
+    return mofjssp::dominates<4>(valueA.data(), valueB.data());
+}
 
-    return at_least_as_good && better;
+bool Solution::dominates(const Objectives<> & valueA,
+                         const Objectives<> & valueB) {
+    return mofjssp::dominates(valueA, valueB);
 }
 
 void Solution::compute_value() {
@@ -40,6 +35,7 @@ void Solution::compute_value() {
     // Computes the maximal machine workload
     // and the total workload of the machines
     this->value[2] = 0.0;
+    this->value[3] = 0.0;
 
     for (unsigned machine = 0;
          machine < this->instance.num_machines;
@@ -89,36 +85,68 @@ Solution::Solution(const Instance & instance,
     this->init();
 }
 
-Solution::Solution(const Instance & instance, const std::vector<double> & key) : Solution(instance) {
-    std::vector<std::pair<double, unsigned>> permutation(this->instance.total_num_operations);
+Solution::Solution(const Instance & instance,
+                   const std::vector<double> & key,
+                   bool active,
+                   const std::shared_ptr<Solution_Pool> & pool,
+                   unsigned arena) :
+        Solution(instance, pool, arena) {
+    std::vector<std::pair<double, unsigned>> permutation;
+
+    Solution::decode(this->instance, key, this->machine_of_operation, permutation);
+    this->schedule(permutation, active);
+}
+
+template <class Machines>
+void Solution::decode(const Instance & instance,
+                      const std::vector<double> & key,
+                      Machines & machine_of_operation,
+                      std::vector<std::pair<double, unsigned>> & permutation,
+                      Key_Precision key_precision) {
+    permutation.resize(instance.total_num_operations);
 
     // Uses the first half of the key to compute the machine that will process each operation
 
     // Iterates over each operation of each job
-    for (unsigned job = 0, i = 0; job < this->instance.num_jobs; job++) {
-        for (unsigned operation = 0; operation < this->instance.num_operations[job]; operation++, i++) {
+    for (unsigned job = 0, i = 0; job < instance.num_jobs; job++) {
+        for (unsigned operation = 0; operation < instance.num_operations[job]; operation++, i++) {
             // Computes the machine that will process the operation
-            const unsigned num_machines_of_operation = this->instance.machines_of_operation[job][operation].size(),
-                           machine_index = std::min((unsigned) floor((key[i] * (num_machines_of_operation))),
-                                                    num_machines_of_operation - 1),
-                           machine = this->instance.machines_of_operation[job][operation][machine_index];
+            const unsigned machine = instance.machines_of_operation[job][operation][
+                machine_index(quantize(key[i], key_precision),
+                              instance.machines_of_operation[job][operation].size())];
 
-            this->machine_of_operation[job][operation] = machine;
+            machine_of_operation[job][operation] = machine;
         }
     }
 
     // Uses the second half of the key to compute the order that each operation will be processed
 
     // Computes the order that the jobs' operations will be processed
-    for (unsigned job = 0, i = 0; job < this->instance.num_jobs; job++) {
-        for (unsigned operation = 0; operation < this->instance.num_operations[job]; operation++, i++) {
-            permutation[i] = std::make_pair(key[this->instance.total_num_operations + i], job);
+    for (unsigned job = 0, i = 0; job < instance.num_jobs; job++) {
+        for (unsigned operation = 0; operation < instance.num_operations[job]; operation++, i++) {
+            permutation[i] = std::make_pair(quantize(key[instance.total_num_operations + i], key_precision), job);
         }
     }
 
     std::sort(permutation.begin(), permutation.end());
+}
+
+template void Solution::decode(const Instance & instance,
+                               const std::vector<double> & key,
+                               std::vector<std::vector<unsigned>> & machine_of_operation,
+                               std::vector<std::pair<double, unsigned>> & permutation,
+                               Key_Precision key_precision);
 
+template void Solution::decode(const Instance & instance,
+                               const std::vector<double> & key,
+                               std::pmr::vector<std::pmr::vector<unsigned>> & machine_of_operation,
+                               std::vector<std::pair<double, unsigned>> & permutation,
+                               Key_Precision key_precision);
+
+void Solution::schedule(const std::vector<std::pair<double, unsigned>> & permutation,
+                        bool active) {
     std::vector<unsigned> num_scheduled_operations_of_job(this->instance.num_jobs, 0);
+    std::vector<Gap_Index> gaps_of_machine(active ? this->instance.num_machines : 0);
 
     // Schedules the operations in the order defined by the permutation
     for (std::size_t i = 0; i < permutation.size(); i++) {
@@ -128,6 +156,7 @@ Solution::Solution(const Instance & instance, const std::vector<double> & key) :
         const unsigned job = permutation[i].second,
                        operation = num_scheduled_operations_of_job[job],
                        machine = this->machine_of_operation[job][operation];
+        const double processing_time = this->instance.processing_time.at(std::make_tuple(job, operation, machine));
         double starting_time = 0.0,
                ending_time = 0.0;
 
@@ -137,8 +166,11 @@ Solution::Solution(const Instance & instance, const std::vector<double> & key) :
             starting_time = this->ending_time_of_operation[job][operation - 1];
         }
 
-        // If the machine has already processed some operations
-        if (!this->operations_of_machine[machine].empty()) {
+        if (active) {
+            // The operation starts in the earliest idle interval of the machine where it fits
+            starting_time = gaps_of_machine[machine].insert(starting_time, processing_time);
+        } else if (!this->operations_of_machine[machine].empty()) {
+            // If the machine has already processed some operations
             const unsigned prev_job = this->operations_of_machine[machine].back().first,
                            prev_operation = this->operations_of_machine[machine].back().second;
 
@@ -150,7 +182,7 @@ Solution::Solution(const Instance & instance, const std::vector<double> & key) :
         }
 
         // The ending time of the operation is equal to the starting time plus the processing time
-        ending_time = starting_time + this->instance.processing_time.at(std::make_tuple(job, operation, machine));
+        ending_time = starting_time + processing_time;
 
         // Updates the solution
         this->operations_of_machine[machine].push_back(std::make_pair(job, operation));
@@ -159,17 +191,119 @@ Solution::Solution(const Instance & instance, const std::vector<double> & key) :
         num_scheduled_operations_of_job[job]++;
     }
 
+    // Operations inserted in idle intervals are sorted by their starting times
+    if (active) {
+        for (auto & operations : this->operations_of_machine) {
+            std::sort(operations.begin(), operations.end(),
+                      [this](const auto & a, const auto & b) {
+                          return this->starting_time_of_operation[a.first][a.second] <
+                                 this->starting_time_of_operation[b.first][b.second];
+                      });
+        }
+    }
+
     // Computes the value of the solution
     this->compute_value();
 }
 
-Solution::Solution(const Instance & instance) :
+std::vector<std::pair<unsigned, unsigned>> Solution::critical_path() const {
+    std::vector<std::pair<unsigned, unsigned>> path;
+    std::vector<std::vector<std::pair<unsigned, unsigned>>> machine_predecessor(this->instance.num_jobs);
+    unsigned job = 0, operation = 0;
+
+    for (unsigned j = 0; j < this->instance.num_jobs; j++) {
+        machine_predecessor[j].assign(this->instance.num_operations[j],
+                                      std::make_pair(this->instance.num_jobs, 0));
+
+        if (this->ending_time_of_operation[j].back() >
+                this->ending_time_of_operation[job].back()) {
+            job = j;
+        }
+    }
+
+    for (unsigned machine = 0; machine < this->instance.num_machines; machine++) {
+        for (std::size_t i = 1; i < this->operations_of_machine[machine].size(); i++) {
+            const auto & [j, o] = this->operations_of_machine[machine][i];
+            machine_predecessor[j][o] = this->operations_of_machine[machine][i - 1];
+        }
+    }
+
+    // Walks back from the operation that ends last
+    operation = this->instance.num_operations[job] - 1;
+
+    for (;;) {
+        const double starting_time = this->starting_time_of_operation[job][operation];
+        const auto [prev_job, prev_operation] = machine_predecessor[job][operation];
+
+        path.push_back(std::make_pair(job, operation));
+
+        if (prev_job < this->instance.num_jobs &&
+                this->ending_time_of_operation[prev_job][prev_operation] == starting_time) {
+            job = prev_job;
+            operation = prev_operation;
+        } else if (operation > 0 &&
+                this->ending_time_of_operation[job][operation - 1] == starting_time) {
+            operation--;
+        } else {
+            break;
+        }
+    }
+
+    std::reverse(path.begin(), path.end());
+
+    return path;
+}
+
+std::vector<double> Solution::key() const {
+    std::vector<double> key(2 * this->instance.total_num_operations);
+    std::vector<std::tuple<double, unsigned, unsigned>> order;
+
+    order.reserve(this->instance.total_num_operations);
+
+    // The first half selects the machine in the middle of its interval
+    for (unsigned job = 0, i = 0; job < this->instance.num_jobs; job++) {
+        for (unsigned operation = 0; operation < this->instance.num_operations[job]; operation++, i++) {
+            const std::vector<unsigned> & machines = this->instance.machines_of_operation[job][operation];
+            const std::size_t machine_index = std::find(machines.begin(),
+                                                        machines.end(),
+                                                        this->machine_of_operation[job][operation]) -
+                                              machines.begin();
+
+            key[i] = (machine_index + 0.5) / machines.size();
+            order.push_back(std::make_tuple(this->starting_time_of_operation[job][operation], job, i));
+        }
+    }
+
+    // The second half sequences the operations by their starting times,
+    // which reproduces the machine and job sequences of this solution
+    std::stable_sort(order.begin(), order.end(),
+                     [](const auto & a, const auto & b) {
+                         return std::get<0>(a) < std::get<0>(b);
+                     });
+
+    for (std::size_t position = 0; position < order.size(); position++) {
+        key[this->instance.total_num_operations + std::get<2>(order[position])] =
+            (position + 0.5) / order.size();
+    }
+
+    return key;
+}
+
+Solution::Solution(const Instance & instance,
+                   const std::shared_ptr<Solution_Pool> & pool,
+                   unsigned arena) :
         instance(instance),
-        machine_of_operation(instance.num_jobs),
-        operations_of_machine(instance.num_machines),
-        starting_time_of_operation(instance.num_jobs),
-        ending_time_of_operation(instance.num_jobs),
-        value(instance.num_objectives) {
+        pool(pool),
+        machine_of_operation(instance.num_jobs,
+                             pool ? pool->arena(arena) :
+                                    std::pmr::get_default_resource()),
+        operations_of_machine(instance.num_machines,
+                              machine_of_operation.get_allocator()),
+        starting_time_of_operation(instance.num_jobs,
+                                   machine_of_operation.get_allocator()),
+        ending_time_of_operation(instance.num_jobs,
+                                 machine_of_operation.get_allocator()),
+        value() {
     for (unsigned job = 0; job < this->instance.num_jobs; job++) {
         this->machine_of_operation[job].resize(
             this->instance.num_operations[job]);
@@ -187,6 +321,16 @@ Solution::Solution(const Instance & instance) :
     }
 }
 
+Solution::Solution(const Solution & solution) :
+        instance(solution.instance),
+        machine_of_operation(solution.machine_of_operation),
+        operations_of_machine(solution.operations_of_machine),
+        starting_time_of_operation(solution.starting_time_of_operation),
+        ending_time_of_operation(solution.ending_time_of_operation),
+        value(solution.value) {}
+
+Solution::Solution(Solution && solution) = default;
+
 bool Solution::is_feasible() const {
     if (!this->instance.is_valid()) {
         return false;
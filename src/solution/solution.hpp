@@ -1,6 +1,11 @@
 #pragma once
 
 #include "instance/instance.hpp"
+#include "solution/gap_index.hpp"
+#include "solution/key_precision.hpp"
+#include "solution/objectives.hpp"
+#include "solution/solution_pool.hpp"
+#include <memory_resource>
 
 namespace mofjssp {
 /********************************************************
@@ -20,30 +25,47 @@ class Solution {
     static bool dominates(const std::vector<double> & valueA,
                           const std::vector<double> & valueB);
 
+    /************************************************************
+     * Returns true if valueA dominates valueB; false otherwise.
+     *
+     * @param valueA the first value been compared.
+     * @param valueB the second value been compared.
+     *
+     * @return true if valueA dominates valueB; false otherwise.
+     ************************************************************/
+    static bool dominates(const Objectives<> & valueA,
+                          const Objectives<> & valueB);
+
     /****************************
      * The instance been solved.
      ****************************/
     const Instance & instance;
 
+    /*****************************************************************
+     * The pool from which the schedule is allocated, if any, which is
+     * kept alive as long as the schedule.
+     *****************************************************************/
+    std::shared_ptr<Solution_Pool> pool;
+
     /***********************************************************
      * The machine that is used for each operation of each job.
      ***********************************************************/
-    std::vector<std::vector<unsigned>> machine_of_operation;
+    std::pmr::vector<std::pmr::vector<unsigned>> machine_of_operation;
 
     /******************************************************************************
      * The operations that are processed by each machine, in order.
      ******************************************************************************/
-    std::vector<std::vector<std::pair<unsigned, unsigned>>> operations_of_machine;
+    std::pmr::vector<std::pmr::vector<std::pair<unsigned, unsigned>>> operations_of_machine;
 
     /**************************************************************
      * The time that each operation of each job starts processing.
      **************************************************************/
-    std::vector<std::vector<double>> starting_time_of_operation;
+    std::pmr::vector<std::pmr::vector<double>> starting_time_of_operation;
 
     /************************************************************
      * The time that each operation of each job ends processing.
      ************************************************************/
-    std::vector<std::vector<double>> ending_time_of_operation;
+    std::pmr::vector<std::pmr::vector<double>> ending_time_of_operation;
 
     /**************************************************************************
      * The value of the solution, that consists of:
@@ -54,14 +76,14 @@ class Solution {
      * - total workload of the machines, which represents the total working 
      *   time of all machines.
      **************************************************************************/
-    std::vector<double> value;
+    Objectives<> value;
 
-    private:
     /**************************************
      * Computes the value of the solution.
      **************************************/
     void compute_value();
 
+    private:
     /******************************
      * Initializes a new solution.
      ******************************/
@@ -87,16 +109,101 @@ class Solution {
      * @param instance     the instance been solved.
      * @param key          the key representing the machine assignment and
      *                     scheduling of each operation of each job.
+     * @param active       whether the schedule is active, i.e., whether
+     *                     the operations are inserted in idle intervals.
+     * @param pool         the pool from which the schedule is allocated
+     *                     (the heap if none); copies use the heap.
+     * @param arena        the arena of the pool.
      **********************************************************************/
     Solution(const Instance & instance,
-             const std::vector<double> & key);
+             const std::vector<double> & key,
+             bool active = false,
+             const std::shared_ptr<Solution_Pool> & pool = nullptr,
+             unsigned arena = 0);
 
-    /********************************************
+    /*******************************************************
      * Constructs a new solution.
      *
      * @param instance the instance been solved.
-     ********************************************/
-    Solution(const Instance & instance);
+     * @param pool     the pool from which the schedule is
+     *                 allocated (the heap if none).
+     * @param arena    the arena of the pool.
+     *******************************************************/
+    Solution(const Instance & instance,
+             const std::shared_ptr<Solution_Pool> & pool = nullptr,
+             unsigned arena = 0);
+
+    /**************************************************************************
+     * Decodes the machine assignment and the scheduling order of a key.
+     *
+     * @param instance             the instance been solved.
+     * @param key                  the key representing the machine assignment
+     *                             and scheduling of each operation of each job.
+     * @param machine_of_operation the machine that is used for each operation
+     *                             of each job (a vector of vectors, either
+     *                             standard or polymorphic).
+     * @param permutation          the (key, job) pairs, sorted in the order
+     *                             that the operations are scheduled.
+     * @param key_precision        the precision to which each allele is
+     *                             quantized as it is read.
+     **************************************************************************/
+    template <class Machines>
+    static void decode(const Instance & instance,
+                       const std::vector<double> & key,
+                       Machines & machine_of_operation,
+                       std::vector<std::pair<double, unsigned>> & permutation,
+                       Key_Precision key_precision = Key_Precision::DOUBLE);
+
+    /**************************************************************************
+     * Schedules the operations of this empty solution, whose machine of each
+     * operation is already set, and computes its value.
+     *
+     * The schedule is semi-active by default: each operation starts after
+     * the last operation scheduled on its machine. If active, each operation
+     * starts in the earliest idle interval of its machine where it fits.
+     *
+     * @param permutation the (key, job) pairs, sorted in the order that the
+     *                    operations are scheduled.
+     * @param active      whether the schedule is active.
+     **************************************************************************/
+    void schedule(const std::vector<std::pair<double, unsigned>> & permutation,
+                  bool active = false);
+
+    /**************************************************************************
+     * Computes a critical path of this solution, i.e., a chain of operations
+     * from time zero to the makespan in which each operation starts when its
+     * predecessor on the same machine or on the same job ends. Machine
+     * predecessors are preferred, so that the critical blocks (consecutive
+     * operations on the same machine) are as long as possible.
+     *
+     * @return the (job, operation) pairs of the path, in processing order.
+     **************************************************************************/
+    std::vector<std::pair<unsigned, unsigned>> critical_path() const;
+
+    /**************************************************************************
+     * Encodes this solution as a key, which is decoded back to the same
+     * machine assignment and the same machine and job sequences by the
+     * semi-active schedule.
+     *
+     * @return the key of this solution.
+     **************************************************************************/
+    std::vector<double> key() const;
+
+    /*************************************************
+     * Copy constructor. The copy is allocated from
+     * the heap, rather than from the pool, if any.
+     *
+     * @param solution the solution been copied.
+     *************************************************/
+    Solution(const Solution & solution);
+
+    /*******************************************************************
+     * Move constructor. Solutions refer to their instance, so they are
+     * not assignable; they are copied or moved into place instead.
+     *
+     * @param solution the solution been moved.
+     *******************************************************************/
+    Solution(Solution && solution);
 
     /*********************************************
      * Verifies whether this solution is
@@ -0,0 +1,60 @@
+#include "solution/solution_pool.hpp"
+#include <algorithm>
+#include <cstddef>
+
+namespace mofjssp {
+
+// The number of bytes of an allocation of a number of elements,
+// rounded up to the alignment of the arenas
+template <class T>
+static std::size_t size_of_allocation(std::size_t num_elements) {
+    constexpr std::size_t alignment = alignof(std::max_align_t);
+
+    return (num_elements * sizeof(T) + alignment - 1) / alignment * alignment;
+}
+
+Solution_Pool::Solution_Pool(const Instance & instance,
+                             std::size_t num_solutions,
+                             unsigned num_arenas) {
+    const std::size_t size = std::max<std::size_t>(
+            1, num_solutions * Solution_Pool::size_of_solution(instance));
+
+    for (unsigned i = 0; i < num_arenas; i++) {
+        this->buffers.emplace_back(new std::byte[size]);
+        this->arenas.emplace_back(
+                new std::pmr::monotonic_buffer_resource(
+                    this->buffers.back().get(), size));
+    }
+}
+
+std::size_t Solution_Pool::size_of_solution(const Instance & instance) {
+    // The machine, starting time and ending time of each operation of
+    // each job, and the operations of each machine
+    std::size_t size =
+        size_of_allocation<std::pmr::vector<unsigned>>(instance.num_jobs) +
+        2 * size_of_allocation<std::pmr::vector<double>>(instance.num_jobs) +
+        size_of_allocation<std::pmr::vector<std::pair<unsigned, unsigned>>>(
+                instance.num_machines);
+
+    for (unsigned job = 0; job < instance.num_jobs; job++) {
+        size += size_of_allocation<unsigned>(instance.num_operations[job]) +
+                2 * size_of_allocation<double>(instance.num_operations[job]);
+    }
+
+    for (const auto & operations : instance.operations_of_machine) {
+        size += size_of_allocation<std::pair<unsigned, unsigned>>(
+                operations.size());
+    }
+
+    return size;
+}
+
+unsigned Solution_Pool::num_arenas() const {
+    return this->arenas.size();
+}
+
+std::pmr::memory_resource * Solution_Pool::arena(unsigned i) const {
+    return this->arenas[i].get();
+}
+
+}
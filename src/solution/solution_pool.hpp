@@ -0,0 +1,72 @@
+#pragma once
+
+#include "instance/instance.hpp"
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace mofjssp {
+/*********************************************************************
+ * The Solution_Pool class owns contiguous buffers from which the
+ * schedules of many solutions are allocated, instead of dozens of
+ * small allocations per solution. The buffers are split in arenas,
+ * one per thread building solutions, since an arena is not
+ * thread-safe.
+ *********************************************************************/
+class Solution_Pool {
+    private:
+    /*****************************
+     * The buffer of each arena.
+     *****************************/
+    std::vector<std::unique_ptr<std::byte[]>> buffers;
+
+    /*****************************
+     * The arenas.
+     *****************************/
+    std::vector<std::unique_ptr<std::pmr::monotonic_buffer_resource>> arenas;
+
+    public:
+    /******************************************************************
+     * Constructs a new solution pool.
+     *
+     * @param instance      the instance of the solutions.
+     * @param num_solutions the number of solutions of each arena.
+     * @param num_arenas    the number of arenas.
+     ******************************************************************/
+    Solution_Pool(const Instance & instance,
+                  std::size_t num_solutions,
+                  unsigned num_arenas = 1);
+
+    Solution_Pool(const Solution_Pool & pool) = delete;
+
+    Solution_Pool & operator = (const Solution_Pool & pool) = delete;
+
+    /**************************************************************
+     * Returns the number of bytes allocated for the schedule of a
+     * solution of an instance.
+     *
+     * @param instance the instance.
+     *
+     * @return the number of bytes of a solution.
+     **************************************************************/
+    static std::size_t size_of_solution(const Instance & instance);
+
+    /******************************
+     * Returns the number of arenas.
+     *
+     * @return the number of arenas.
+     ******************************/
+    unsigned num_arenas() const;
+
+    /************************************
+     * Returns an arena.
+     *
+     * @param i the index of the arena.
+     *
+     * @return the arena.
+     ************************************/
+    std::pmr::memory_resource * arena(unsigned i) const;
+};
+
+}
@@ -0,0 +1,220 @@
+#include "solver/archive.hpp"
+
+namespace mofjssp {
+
+Archive::Shard & Archive::shard_of_this_thread() {
+    return *this->shards[std::hash<std::thread::id>()(
+            std::this_thread::get_id()) % this->shards.size()];
+}
+
+Archive::Archive(const std::vector<NSBRKGA::Sense> & senses,
+                 unsigned max_num_solutions,
+                 unsigned batch_size,
+                 unsigned num_shards)
+    : senses(senses),
+      max_num_solutions(max_num_solutions),
+      batch_size(std::max(1u, batch_size)),
+      shards(std::max(1u, num_shards)),
+      num_pending(0),
+      stopped(false),
+      front(std::make_shared<const Front>()) {
+    for (auto & shard : this->shards) {
+        shard = std::make_unique<Shard>();
+    }
+
+    this->merger = std::thread(&Archive::merge_batches, this);
+}
+
+Archive::~Archive() {
+    {
+        std::lock_guard<std::mutex> lock(this->merger_mutex);
+        this->stopped = true;
+    }
+
+    this->merger_condition.notify_one();
+    this->merger.join();
+}
+
+void Archive::merge_batches() {
+    std::unique_lock<std::mutex> lock(this->merger_mutex);
+
+    while (true) {
+        this->merger_condition.wait(lock, [this]() {
+            return this->stopped || this->num_pending >= this->batch_size;
+        });
+
+        if (this->stopped) {
+            return;
+        }
+
+        lock.unlock();
+        this->flush();
+        lock.lock();
+    }
+}
+
+bool Archive::update(Front & best_individuals,
+                     const Front & new_individuals,
+                     const std::vector<NSBRKGA::Sense> & senses) {
+    if (new_individuals.empty()) {
+        return false;
+    }
+
+    const std::size_t num_best_individuals = best_individuals.size();
+    Objective_Matrix values(senses);
+
+    for (const auto & individual : best_individuals) {
+        values.push_back(individual.first);
+    }
+
+    for (const auto & individual : new_individuals) {
+        values.push_back(individual.first);
+    }
+
+    std::vector<std::size_t> front = Non_Dominated_Sort::sort(values,
+                                                              true).front();
+
+    // Keeps a single individual of each value, preferring the best
+    // individuals found so far to the new ones
+    std::vector<std::size_t> order = front;
+    std::vector<bool> is_duplicate(values.size(), false);
+
+    std::sort(order.begin(), order.end(),
+              [&values](std::size_t a, std::size_t b) {
+                  for (const auto & column : values.columns) {
+                      if (column[a] != column[b]) {
+                          return column[a] < column[b];
+                      }
+                  }
+
+                  return a < b;
+              });
+
+    for (std::size_t i = 1; i < order.size(); i++) {
+        is_duplicate[order[i]] = std::all_of(
+                values.columns.begin(),
+                values.columns.end(),
+                [&order, i](const std::vector<double> & column) {
+                    return fabs(column[order[i]] - column[order[i - 1]]) <
+                        std::numeric_limits<double>::epsilon();
+                });
+    }
+
+    Front individuals;
+    bool result = false;
+
+    individuals.reserve(front.size());
+
+    for (const std::size_t & i : front) {
+        if (is_duplicate[i]) {
+            continue;
+        }
+
+        if (i < num_best_individuals) {
+            individuals.push_back(std::move(best_individuals[i]));
+        } else {
+            individuals.push_back(new_individuals[i - num_best_individuals]);
+            result = true;
+        }
+    }
+
+    best_individuals.swap(individuals);
+
+    return result;
+}
+
+bool Archive::truncate(Front & best_individuals,
+                       unsigned max_num_solutions) {
+    if (best_individuals.size() <= max_num_solutions) {
+        return false;
+    }
+
+    NSBRKGA::Population::crowdingSort<std::vector<double>>(best_individuals);
+    best_individuals.resize(max_num_solutions);
+
+    return true;
+}
+
+void Archive::publish(const Front & new_individuals) {
+    if (new_individuals.empty()) {
+        return;
+    }
+
+    // Filters the dominated individuals before taking any lock
+    auto non_dominated_new_individuals =
+        Non_Dominated_Sort::first_front(new_individuals, this->senses);
+
+    std::size_t num_pending;
+
+    {
+        Shard & shard = this->shard_of_this_thread();
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        shard.pending.insert(
+                shard.pending.end(),
+                std::make_move_iterator(non_dominated_new_individuals.begin()),
+                std::make_move_iterator(non_dominated_new_individuals.end()));
+
+        num_pending = this->num_pending.fetch_add(
+                non_dominated_new_individuals.size()) +
+            non_dominated_new_individuals.size();
+    }
+
+    if (num_pending >= this->batch_size) {
+        // Locking before notifying, so that the merger does not miss the
+        // batch between checking for it and waiting
+        {
+            std::lock_guard<std::mutex> lock(this->merger_mutex);
+        }
+
+        this->merger_condition.notify_one();
+    }
+}
+
+bool Archive::flush() {
+    std::lock_guard<std::mutex> merge_lock(this->merge_mutex);
+    Front batch;
+
+    for (auto & shard : this->shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+
+        if (batch.empty()) {
+            batch.swap(shard->pending);
+        } else {
+            batch.insert(batch.end(),
+                         std::make_move_iterator(shard->pending.begin()),
+                         std::make_move_iterator(shard->pending.end()));
+            shard->pending.clear();
+        }
+    }
+
+    this->num_pending.fetch_sub(batch.size());
+
+    if (batch.empty()) {
+        return false;
+    }
+
+    // Only this thread modifies the front, so the readers keep using
+    // the previous snapshot until the new one is stored
+    auto new_front = std::make_shared<Front>(*std::atomic_load(&this->front));
+    bool result = Archive::update(*new_front, batch, this->senses);
+
+    result = Archive::truncate(*new_front, this->max_num_solutions) || result;
+
+    if (result) {
+        std::atomic_store(&this->front,
+                          std::shared_ptr<const Front>(std::move(new_front)));
+    }
+
+    return result;
+}
+
+std::shared_ptr<const Archive::Front> Archive::snapshot() const {
+    return std::atomic_load(&this->front);
+}
+
+std::size_t Archive::size() const {
+    return this->snapshot()->size();
+}
+
+}
@@ -0,0 +1,187 @@
+#pragma once
+
+#include "solution/solution.hpp"
+#include "solver/non_dominated_sort.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace mofjssp {
+/*************************************************************
+ * The Archive class represents a thread-safe archive of
+ * non-dominated individuals, to which several threads
+ * (e.g., decoding threads or islands) can publish.
+ *
+ * Publishing only appends to a per-thread shard of pending
+ * individuals; the pending individuals are merged into the
+ * front in batches by a merger thread of the archive, which
+ * also performs the truncation by crowding distance, so the
+ * publishing threads never merge.
+ * Readers obtain an immutable snapshot of the front without
+ * blocking the writers; an old snapshot is released when its
+ * last reader drops it.
+ *************************************************************/
+class Archive {
+    public:
+    /*******************************************************
+     * An individual, represented by its value and its key.
+     *******************************************************/
+    typedef std::pair<std::vector<double>, std::vector<double>> Individual;
+
+    /**************************
+     * A front of individuals.
+     **************************/
+    typedef std::vector<Individual> Front;
+
+    /***************************
+     * The optimization senses.
+     ***************************/
+    const std::vector<NSBRKGA::Sense> senses;
+
+    /******************************************************************
+     * The maximum number of solutions.
+     ******************************************************************/
+    const unsigned max_num_solutions;
+
+    /*****************************************************************
+     * The number of pending individuals that triggers a merge.
+     *****************************************************************/
+    const unsigned batch_size;
+
+    private:
+    /**************************************************
+     * A shard of individuals pending to be merged.
+     **************************************************/
+    struct Shard {
+        std::mutex mutex;
+        Front pending;
+    };
+
+    /*************************************************
+     * The shards of individuals pending to be merged.
+     *************************************************/
+    std::vector<std::unique_ptr<Shard>> shards;
+
+    /*******************************************
+     * The number of pending individuals.
+     *******************************************/
+    std::atomic<std::size_t> num_pending;
+
+    /**************************************
+     * Serializes the merges.
+     **************************************/
+    std::mutex merge_mutex;
+
+    /*****************************************************************
+     * Wakes the merger thread when a batch is pending or the archive
+     * is destroyed.
+     *****************************************************************/
+    std::mutex merger_mutex;
+
+    std::condition_variable merger_condition;
+
+    bool stopped;
+
+    /*****************************************************************
+     * The current front, accessed through std::atomic_load/store.
+     *****************************************************************/
+    std::shared_ptr<const Front> front;
+
+    /*****************************************************
+     * Returns the shard of the calling thread.
+     *
+     * @return the shard of the calling thread.
+     *****************************************************/
+    Shard & shard_of_this_thread();
+
+    /*****************************************************
+     * Merges the pending batches until stopped.
+     *****************************************************/
+    void merge_batches();
+
+    /*********************************
+     * The merger thread.
+     *********************************/
+    std::thread merger;
+
+    public:
+    /***********************************************************************
+     * Constructs a new archive.
+     *
+     * @param senses            the optimization senses.
+     * @param max_num_solutions the maximum number of solutions.
+     * @param batch_size        the number of pending individuals that
+     *                          triggers a merge.
+     * @param num_shards        the number of shards of pending individuals.
+     ***********************************************************************/
+    Archive(const std::vector<NSBRKGA::Sense> & senses,
+            unsigned max_num_solutions = std::numeric_limits<unsigned>::max(),
+            unsigned batch_size = 1,
+            unsigned num_shards = std::max(1u,
+                std::thread::hardware_concurrency()));
+
+    /*************************************************************
+     * Destroys this archive, stopping its merger thread. The
+     * individuals still pending are discarded.
+     *************************************************************/
+    ~Archive();
+
+    /*********************************************************************
+     * Update the best individuals found so far.
+     *
+     * @param best_individuals the best individuals found so far.
+     * @param new_individuals  the new individuals found.
+     * @param senses           the optimisation senses.
+     *
+     * @return true if the best individual are modified; false otherwise.
+     *********************************************************************/
+    static bool update(Front & best_individuals,
+                       const Front & new_individuals,
+                       const std::vector<NSBRKGA::Sense> & senses);
+
+    /*********************************************************************
+     * Truncates the best individuals by crowding distance.
+     *
+     * @param best_individuals  the best individuals found so far.
+     * @param max_num_solutions the maximum number of solutions.
+     *
+     * @return true if the best individual are modified; false otherwise.
+     *********************************************************************/
+    static bool truncate(Front & best_individuals,
+                         unsigned max_num_solutions);
+
+    /*********************************************************************
+     * Publishes new individuals to this archive.
+     * The individuals are merged by the merger thread once the batch
+     * size is reached, or by flush.
+     *
+     * @param new_individuals the new individuals found.
+     *********************************************************************/
+    void publish(const Front & new_individuals);
+
+    /*********************************************************************
+     * Merges all pending individuals into the front.
+     *
+     * @return true if the front is modified; false otherwise.
+     *********************************************************************/
+    bool flush();
+
+    /****************************************************
+     * Returns a snapshot of the current front, without the
+     * individuals still pending.
+     *
+     * @return a snapshot of the current front.
+     ****************************************************/
+    std::shared_ptr<const Front> snapshot() const;
+
+    /**********************************************************
+     * Returns the number of individuals in the current front.
+     *
+     * @return the number of individuals in the current front.
+     **********************************************************/
+    std::size_t size() const;
+};
+
+}
@@ -0,0 +1,118 @@
+#include "solver/decode_cache.hpp"
+
+namespace mofjssp {
+
+// The finalizer of splitmix64
+static std::uint64_t mix(std::uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+Decode_Cache::Shard & Decode_Cache::shard_of(const Key & key) {
+    return *this->shards[key.second % this->shards.size()];
+}
+
+Decode_Cache::Decode_Cache(std::size_t max_size, unsigned num_shards)
+    : max_size(max_size),
+      num_hits(0),
+      num_misses(0),
+      shards(std::max(1u, num_shards)) {
+    for (auto & shard : this->shards) {
+        shard = std::make_unique<Shard>();
+    }
+
+    this->max_size_of_shard = std::max<std::size_t>(
+            1, this->max_size / this->shards.size());
+}
+
+template <class Machines>
+Decode_Cache::Key Decode_Cache::key(
+        const Machines & machine_of_operation,
+        const std::vector<std::pair<double, unsigned>> & permutation) {
+    // The first hash is a chain of splitmix64 steps and the second an
+    // FNV-1a, so that a collision in one is unlikely to be in the other
+    std::uint64_t first = 0x9e3779b97f4a7c15ULL,
+                  second = 0xcbf29ce484222325ULL;
+
+    for (const auto & machines : machine_of_operation) {
+        for (const unsigned & machine : machines) {
+            first = mix(first + machine);
+            second = (second ^ machine) * 0x100000001b3ULL;
+        }
+    }
+
+    for (const auto & [key, job] : permutation) {
+        first = mix(first + job + 0x9e3779b97f4a7c15ULL);
+        second = (second ^ (job + 0x10000ULL)) * 0x100000001b3ULL;
+    }
+
+    return std::make_pair(first, mix(second));
+}
+
+template Decode_Cache::Key Decode_Cache::key(
+        const std::vector<std::vector<unsigned>> & machine_of_operation,
+        const std::vector<std::pair<double, unsigned>> & permutation);
+
+template Decode_Cache::Key Decode_Cache::key(
+        const std::pmr::vector<std::pmr::vector<unsigned>> &
+            machine_of_operation,
+        const std::vector<std::pair<double, unsigned>> & permutation);
+
+bool Decode_Cache::find(const Key & key, Objectives<> & value) {
+    Shard & shard = this->shard_of(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.index.find(key);
+
+    if (it == shard.index.end()) {
+        this->num_misses++;
+        return false;
+    }
+
+    shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+    value = it->second->second;
+    this->num_hits++;
+
+    return true;
+}
+
+void Decode_Cache::insert(const Key & key, const Objectives<> & value) {
+    Shard & shard = this->shard_of(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    if (shard.index.count(key) > 0) {
+        // Another thread decoded the same schedule in the meantime
+        return;
+    }
+
+    if (shard.entries.size() >= this->max_size_of_shard) {
+        shard.index.erase(shard.entries.back().first);
+        shard.entries.pop_back();
+    }
+
+    shard.entries.emplace_front(key, value);
+    shard.index[key] = shard.entries.begin();
+}
+
+double Decode_Cache::hit_rate() const {
+    const std::size_t num_lookups = this->num_hits + this->num_misses;
+
+    if (num_lookups == 0) {
+        return 0.0;
+    }
+
+    return double(this->num_hits) / double(num_lookups);
+}
+
+std::size_t Decode_Cache::size() {
+    std::size_t result = 0;
+
+    for (auto & shard : this->shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        result += shard->entries.size();
+    }
+
+    return result;
+}
+
+}
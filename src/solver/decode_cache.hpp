@@ -0,0 +1,153 @@
+#pragma once
+
+#include "solution/objectives.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace mofjssp {
+/*****************************************************************
+ * The Decode_Cache class represents a bounded, thread-safe cache
+ * of objective values, keyed by a hash of the decoded schedule
+ * (the machine of each operation and the sequence in which the
+ * operations are scheduled).
+ *
+ * Different keys (chromosomes) often decode to the same schedule,
+ * so the key of the schedule is computed before the timing
+ * simulation and, on a hit, the simulation is skipped.
+ * The entries are spread over shards, each with its own lock and
+ * evicting its least recently used entries.
+ *****************************************************************/
+class Decode_Cache {
+    public:
+    /**********************************************************
+     * The key of a schedule, made of two independent hashes.
+     **********************************************************/
+    typedef std::pair<std::uint64_t, std::uint64_t> Key;
+
+    /*****************************************
+     * The maximum number of cached values.
+     *****************************************/
+    const std::size_t max_size;
+
+    /******************************
+     * The number of cache hits.
+     ******************************/
+    std::atomic<std::size_t> num_hits;
+
+    /******************************
+     * The number of cache misses.
+     ******************************/
+    std::atomic<std::size_t> num_misses;
+
+    private:
+    /***********************************
+     * Hashes a key for the shard maps.
+     ***********************************/
+    struct Key_Hash {
+        std::size_t operator()(const Key & key) const {
+            return key.first;
+        }
+    };
+
+    /********************************************************
+     * A shard of entries, from the most to the least
+     * recently used, and the index of its entries.
+     ********************************************************/
+    struct Shard {
+        std::mutex mutex;
+        std::list<std::pair<Key, Objectives<>>> entries;
+        std::unordered_map<Key,
+                           std::list<std::pair<Key,
+                                               Objectives<>>>::iterator,
+                           Key_Hash> index;
+    };
+
+    /*****************
+     * The shards.
+     *****************/
+    std::vector<std::unique_ptr<Shard>> shards;
+
+    /********************************************
+     * The maximum number of entries per shard.
+     ********************************************/
+    std::size_t max_size_of_shard;
+
+    /****************************************
+     * Returns the shard of the given key.
+     *
+     * @param key the key.
+     *
+     * @return the shard of the key.
+     ****************************************/
+    Shard & shard_of(const Key & key);
+
+    public:
+    /**************************************************************
+     * Constructs a new decode cache.
+     *
+     * @param max_size   the maximum number of cached values.
+     * @param num_shards the number of shards.
+     **************************************************************/
+    Decode_Cache(std::size_t max_size,
+                 unsigned num_shards =
+                    std::max(1u, std::thread::hardware_concurrency()));
+
+    /********************************************************************
+     * Computes the key of a schedule.
+     *
+     * @param machine_of_operation the machine of each operation of
+     *                             each job (a vector of vectors, either
+     *                             standard or polymorphic).
+     * @param permutation          the (key, job) pairs, sorted in the
+     *                             order the operations are scheduled.
+     *
+     * @return the key of the schedule.
+     ********************************************************************/
+    template <class Machines>
+    static Key key(
+            const Machines & machine_of_operation,
+            const std::vector<std::pair<double, unsigned>> & permutation);
+
+    /***************************************************************
+     * Looks up the value of a schedule.
+     *
+     * @param key   the key of the schedule.
+     * @param value the cached value, if found.
+     *
+     * @return true if the value was found; false otherwise.
+     ***************************************************************/
+    bool find(const Key & key, Objectives<> & value);
+
+    /*****************************************************************
+     * Caches the value of a schedule, evicting the least recently
+     * used value of its shard if the shard is full.
+     *
+     * @param key   the key of the schedule.
+     * @param value the value of the schedule.
+     *****************************************************************/
+    void insert(const Key & key, const Objectives<> & value);
+
+    /*************************************************
+     * Returns the fraction of lookups that were hits.
+     *
+     * @return the hit rate.
+     *************************************************/
+    double hit_rate() const;
+
+    /*****************************************
+     * Returns the number of cached values.
+     *
+     * @return the number of cached values.
+     *****************************************/
+    std::size_t size();
+};
+
+}
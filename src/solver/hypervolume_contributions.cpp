@@ -0,0 +1,292 @@
+#include "solver/hypervolume_contributions.hpp"
+#include "solver/indicators.hpp"
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace mofjssp {
+
+Truncation parse_truncation(const std::string & truncation) {
+    if (truncation == "crowding") {
+        return Truncation::CROWDING_DISTANCE;
+    } else if (truncation == "hypervolume") {
+        return Truncation::HYPERVOLUME_CONTRIBUTION;
+    }
+
+    throw std::invalid_argument("Invalid truncation " + truncation + ".");
+}
+
+std::string to_string(Truncation truncation) {
+    switch (truncation) {
+        case Truncation::HYPERVOLUME_CONTRIBUTION:
+            return "hypervolume";
+        default:
+            return "crowding";
+    }
+}
+
+Hypervolume_Contributions::Hypervolume_Contributions(
+        const std::vector<NSBRKGA::Sense> & senses,
+        const std::vector<double> & reference_point)
+    : senses(senses),
+      reference_point(reference_point),
+      minimization_reference_point(this->to_minimization(reference_point)) {}
+
+std::vector<double> Hypervolume_Contributions::to_minimization(
+        const std::vector<double> & value) const {
+    std::vector<double> point(value);
+
+    for (unsigned i = 0; i < this->senses.size(); i++) {
+        if (this->senses[i] == NSBRKGA::Sense::MAXIMIZE) {
+            point[i] = -point[i];
+        }
+    }
+
+    return point;
+}
+
+const double * Hypervolume_Contributions::point(std::size_t i) const {
+    return this->points.data() + i * this->senses.size();
+}
+
+std::size_t Hypervolume_Contributions::find(
+        const std::vector<double> & point) const {
+    for (std::size_t i = 0; i < this->size(); i++) {
+        if (std::equal(point.begin(), point.end(), this->point(i))) {
+            return i;
+        }
+    }
+
+    return this->size();
+}
+
+std::vector<std::size_t> Hypervolume_Contributions::neighbours(
+        const double * point,
+        std::size_t skipped) const {
+    const unsigned num_objectives = this->senses.size();
+    std::vector<double> limits(this->points.size());
+    std::vector<std::pair<double, std::size_t>> order;
+    std::vector<std::size_t> neighbours;
+
+    order.reserve(this->size());
+
+    // The limit of each point inside the reference box, i.e., the corner
+    // of the box shared by it and the point
+    for (std::size_t q = 0; q < this->size(); q++) {
+        const double * other = this->point(q);
+        double * limit = limits.data() + q * num_objectives;
+        double sum = 0.0;
+        bool inside = q != skipped;
+
+        for (unsigned k = 0; k < num_objectives && inside; k++) {
+            limit[k] = std::max(point[k], other[k]);
+            inside = limit[k] < this->minimization_reference_point[k];
+            sum += limit[k];
+        }
+
+        if (inside) {
+            order.emplace_back(sum, q);
+        }
+    }
+
+    // A limit is only weakly dominated by limits with a smaller or
+    // equal sum, which come before it
+    std::sort(order.begin(), order.end());
+
+    for (const auto & entry : order) {
+        const double * limit = limits.data() + entry.second * num_objectives;
+        bool dominated = false;
+
+        for (unsigned j = 0; j < neighbours.size() && !dominated; j++) {
+            const double * other =
+                limits.data() + neighbours[j] * num_objectives;
+
+            dominated = true;
+
+            for (unsigned k = 0; k < num_objectives && dominated; k++) {
+                dominated = other[k] <= limit[k];
+            }
+        }
+
+        if (!dominated) {
+            neighbours.push_back(entry.second);
+        }
+    }
+
+    return neighbours;
+}
+
+void Hypervolume_Contributions::update_contribution(std::size_t i) {
+    const unsigned num_objectives = this->senses.size();
+    const double * point = this->point(i);
+    std::vector<std::vector<double>> limit_set;
+    double volume = 1.0;
+
+    for (unsigned k = 0; k < num_objectives; k++) {
+        volume *= std::max(0.0, this->minimization_reference_point[k] -
+                                point[k]);
+    }
+
+    if (volume > 0.0) {
+        // The neighbours bound the part of the box dominated by others
+        for (std::size_t j : this->neighbours(point, i)) {
+            const double * other = this->point(j);
+
+            limit_set.emplace_back(point, point + num_objectives);
+
+            for (unsigned k = 0; k < num_objectives; k++) {
+                limit_set.back()[k] = std::max(point[k], other[k]);
+            }
+        }
+
+        volume -= Indicators::exact_hypervolume(
+                this->minimization_reference_point, limit_set);
+    }
+
+    this->contributions[i] = volume;
+}
+
+std::size_t Hypervolume_Contributions::size() const {
+    return this->contributions.size();
+}
+
+void Hypervolume_Contributions::insert(const std::vector<double> & value) {
+    const std::vector<double> point = this->to_minimization(value);
+    const std::vector<std::size_t> neighbours =
+        this->neighbours(point.data(), this->size());
+
+    this->points.insert(this->points.end(), point.begin(), point.end());
+    this->contributions.push_back(0.0);
+    this->update_contribution(this->size() - 1);
+
+    for (std::size_t q : neighbours) {
+        this->update_contribution(q);
+    }
+}
+
+void Hypervolume_Contributions::erase(const std::vector<double> & value) {
+    const std::vector<double> point = this->to_minimization(value);
+    const std::size_t i = this->find(point);
+    const unsigned num_objectives = this->senses.size();
+
+    if (i == this->size()) {
+        return;
+    }
+
+    // The last point takes the place of the erased one
+    std::copy(this->point(this->size() - 1),
+              this->point(this->size() - 1) + num_objectives,
+              this->points.begin() + i * num_objectives);
+    this->contributions[i] = this->contributions.back();
+    this->points.resize(this->points.size() - num_objectives);
+    this->contributions.pop_back();
+
+    for (std::size_t q : this->neighbours(point.data(), this->size())) {
+        this->update_contribution(q);
+    }
+}
+
+double Hypervolume_Contributions::contribution(
+        const std::vector<double> & value) const {
+    const std::size_t i = this->find(this->to_minimization(value));
+
+    return i < this->size() ? this->contributions[i] : 0.0;
+}
+
+void Hypervolume_Contributions::synchronize(const Archive::Front & front) {
+    const unsigned num_objectives = this->senses.size();
+    std::vector<double> values;
+    std::vector<const double *> new_points, current_points;
+    std::vector<std::vector<double>> added_values, removed_values;
+    const auto less = [num_objectives](const double * a, const double * b) {
+        return std::lexicographical_compare(a, a + num_objectives,
+                                            b, b + num_objectives);
+    };
+
+    values.reserve(front.size() * num_objectives);
+
+    for (const auto & individual : front) {
+        for (unsigned k = 0; k < num_objectives; k++) {
+            values.push_back(this->senses[k] == NSBRKGA::Sense::MAXIMIZE ?
+                                 -individual.first[k] : individual.first[k]);
+        }
+    }
+
+    for (std::size_t i = 0; i < front.size(); i++) {
+        new_points.push_back(values.data() + i * num_objectives);
+    }
+
+    for (std::size_t i = 0; i < this->size(); i++) {
+        current_points.push_back(this->point(i));
+    }
+
+    std::sort(new_points.begin(), new_points.end(), less);
+    std::sort(current_points.begin(), current_points.end(), less);
+
+    // The points of only one of the fronts, with their objective values
+    for (auto new_point = new_points.begin(),
+              current_point = current_points.begin();
+         new_point != new_points.end() ||
+         current_point != current_points.end();) {
+        if (current_point == current_points.end() ||
+                (new_point != new_points.end() &&
+                 less(*new_point, *current_point))) {
+            added_values.push_back(this->to_minimization(std::vector<double>(
+                            *new_point, *new_point + num_objectives)));
+            new_point++;
+        } else if (new_point == new_points.end() ||
+                   less(*current_point, *new_point)) {
+            removed_values.push_back(this->to_minimization(
+                        std::vector<double>(*current_point,
+                                            *current_point + num_objectives)));
+            current_point++;
+        } else {
+            new_point++;
+            current_point++;
+        }
+    }
+
+    // The removed points are usually dominated by the added ones, so
+    // that few points are their neighbours once the added are inserted
+    for (const auto & value : added_values) {
+        this->insert(value);
+    }
+
+    for (const auto & value : removed_values) {
+        this->erase(value);
+    }
+}
+
+bool Hypervolume_Contributions::truncate(Archive::Front & front,
+                                         unsigned max_num_solutions) {
+    // The contributions are only needed, and so synchronized, once the
+    // front exceeds the maximum number of solutions
+    if (front.size() <= max_num_solutions) {
+        return false;
+    }
+
+    this->synchronize(front);
+
+    while (front.size() > max_num_solutions) {
+        const std::size_t least = std::distance(
+                this->contributions.begin(),
+                std::min_element(this->contributions.begin(),
+                                 this->contributions.end()));
+        const std::vector<double> value = this->to_minimization(
+                std::vector<double>(this->point(least),
+                                    this->point(least) +
+                                        this->senses.size()));
+        auto individual = std::find_if(front.begin(), front.end(),
+                [&value](const Archive::Individual & individual) {
+                    return individual.first == value;
+                });
+
+        *individual = std::move(front.back());
+        front.pop_back();
+        this->erase(value);
+    }
+
+    return true;
+}
+
+}
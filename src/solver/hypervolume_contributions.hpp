@@ -0,0 +1,174 @@
+#pragma once
+
+#include "solver/archive.hpp"
+#include <string>
+#include <vector>
+
+namespace mofjssp {
+/*********************************************************************
+ * The ways in which the best individuals are truncated to the
+ * maximum number of solutions: by crowding distance, or by evicting
+ * the individual with the least exclusive hypervolume contribution,
+ * one at a time.
+ *********************************************************************/
+enum class Truncation {
+    CROWDING_DISTANCE,
+    HYPERVOLUME_CONTRIBUTION
+};
+
+/*********************************************************************
+ * Parses a truncation, i.e., "crowding" or "hypervolume".
+ *
+ * @param truncation the name of the truncation.
+ *
+ * @return the truncation.
+ *
+ * @throw std::invalid_argument if the name is not a truncation.
+ *********************************************************************/
+Truncation parse_truncation(const std::string & truncation);
+
+/*********************************************
+ * Returns the name of a truncation.
+ *
+ * @param truncation the truncation.
+ *
+ * @return the name of the truncation.
+ *********************************************/
+std::string to_string(Truncation truncation);
+
+/*********************************************************************
+ * The Hypervolume_Contributions class keeps the exclusive hypervolume
+ * contribution of each point of a front up to date as points are
+ * inserted and erased. A change only recomputes the contributions of
+ * the neighbours of the changed point, i.e., of the points whose box
+ * shared with it is not dominated by a single other point, since the
+ * exclusive region of any other point does not meet the changed box.
+ * Each recomputation only involves the neighbours of the point.
+ *********************************************************************/
+class Hypervolume_Contributions {
+    public:
+    /***************************
+     * The optimization senses.
+     ***************************/
+    const std::vector<NSBRKGA::Sense> senses;
+
+    /*******************************************
+     * The reference point of the hypervolume.
+     *******************************************/
+    const std::vector<double> reference_point;
+
+    private:
+    /*****************************************************************
+     * The reference point and the points, stored row after row, with
+     * the maximization objectives negated.
+     *****************************************************************/
+    std::vector<double> minimization_reference_point;
+
+    std::vector<double> points;
+
+    /*****************************************
+     * The contribution of each point.
+     *****************************************/
+    std::vector<double> contributions;
+
+    /***********************************************
+     * Returns a value with the maximization
+     * objectives negated.
+     ***********************************************/
+    std::vector<double> to_minimization(const std::vector<double> & value) const;
+
+    /***********************************************
+     * Returns the first coordinate of a point.
+     ***********************************************/
+    const double * point(std::size_t i) const;
+
+    /*****************************************************************
+     * Returns the index of a point, or size() if it is not a point.
+     *****************************************************************/
+    std::size_t find(const std::vector<double> & point) const;
+
+    /*****************************************************************
+     * Returns the neighbours of a point, i.e., the points whose limit
+     * with it (their componentwise worst) is inside the reference box
+     * and not weakly dominated by the limit of another point, keeping
+     * one of equal limits. They are the points whose contribution may
+     * change if the point is inserted or erased, and their limits
+     * bound the part of its box dominated by other points.
+     *
+     * @param point   the point, with the maximization objectives
+     *                negated.
+     * @param skipped the index of a point that is not a neighbour, or
+     *                size() if none.
+     *
+     * @return the indices of the neighbours of the point.
+     *****************************************************************/
+    std::vector<std::size_t> neighbours(const double * point,
+                                        std::size_t skipped) const;
+
+    /*********************************************
+     * Recomputes the contribution of a point.
+     *********************************************/
+    void update_contribution(std::size_t i);
+
+    public:
+    /***********************************************************
+     * Constructs a new empty front.
+     *
+     * @param senses          the optimization senses.
+     * @param reference_point the reference point.
+     ***********************************************************/
+    Hypervolume_Contributions(const std::vector<NSBRKGA::Sense> & senses,
+                              const std::vector<double> & reference_point);
+
+    /***********************************
+     * Returns the number of points.
+     *
+     * @return the number of points.
+     ***********************************/
+    std::size_t size() const;
+
+    /*******************************************
+     * Inserts a point.
+     *
+     * @param value the objective values.
+     *******************************************/
+    void insert(const std::vector<double> & value);
+
+    /**********************************************
+     * Erases a point, if present.
+     *
+     * @param value the objective values.
+     **********************************************/
+    void erase(const std::vector<double> & value);
+
+    /*********************************************************
+     * Returns the exclusive contribution of a point.
+     *
+     * @param value the objective values of the point.
+     *
+     * @return the contribution of the point (0 if absent).
+     *********************************************************/
+    double contribution(const std::vector<double> & value) const;
+
+    /*****************************************************************
+     * Inserts and erases the points needed to make the points equal to
+     * the values of a front.
+     *
+     * @param front the front.
+     *****************************************************************/
+    void synchronize(const Archive::Front & front);
+
+    /*****************************************************************
+     * Truncates a front by evicting, one at a time, the individual
+     * with the least contribution. The points are synchronized with
+     * the front first, if it exceeds the maximum number of solutions.
+     *
+     * @param front             the front.
+     * @param max_num_solutions the maximum number of solutions.
+     *
+     * @return true if the front is modified; false otherwise.
+     *****************************************************************/
+    bool truncate(Archive::Front & front, unsigned max_num_solutions);
+};
+
+}
@@ -1,17 +1,24 @@
 #include "solver/ihs/ihs_solver.hpp"
-#include "solver/ihs/problem.hpp"
+#include "solver/problem.hpp"
 #include <pagmo/algorithms/ihs.hpp>
 
 namespace mofjssp {
 
 IHS_Solver::IHS_Solver(const Instance & instance) : Solver::Solver(instance) {}
 
+IHS_Solver::IHS_Solver(const std::shared_ptr<const Instance> & instance)
+    : Solver::Solver(instance) {}
+
 IHS_Solver::IHS_Solver() = default;
 
 void IHS_Solver::solve() {
     this->start_time = std::chrono::steady_clock::now();
+    this->reset_decode_cache();
 
-    pagmo::problem prob{Problem(this->instance)};
+    pagmo::problem prob{Problem(this->instance,
+                                this->decode_cache,
+                                this->active_schedule,
+                                this->key_precision)};
 
     pagmo::algorithm algo{pagmo::ihs(1,
                                      this->phmcr,
@@ -55,9 +62,19 @@ void IHS_Solver::solve() {
 
     while(!this->are_termination_criteria_met()) {
         this->num_iterations++;
-        pop = algo.evolve(pop);
+
+        {
+            MOFJSSP_PROFILE_SCOPE(EVOLVE);
+            pop = algo.evolve(pop);
+        }
+
         this->update_best_individuals(pop);
 
+        if (this->local_search_interval > 0 &&
+                this->num_iterations % this->local_search_interval == 0) {
+            this->improve_best_individuals(pop);
+        }
+
         if(this->max_num_snapshots > this->num_snapshots + 1) {
             if (this->num_iterations >= this->iteration_next_snapshot) {
                 this->capture_snapshot(pop);
@@ -91,13 +108,12 @@ void IHS_Solver::solve() {
         this->capture_snapshot(pop);
     }
 
-    this->best_solutions.clear();
-
-    for(const auto & best_individual : this->best_individuals) {
-        this->best_solutions.push_back(Solution(this->instance,
-                                                best_individual.second));
+    if (this->local_search) {
+        this->improve_best_individuals();
     }
 
+    this->materialize_best_solutions();
+
     this->solving_time = this->elapsed_time();
 }
 
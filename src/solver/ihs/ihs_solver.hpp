@@ -47,6 +47,13 @@ class IHS_Solver : public Solver {
      *********************************************/
     IHS_Solver(const Instance & instance);
 
+    /*********************************************
+     * Constructs a new solver.
+     *
+     * @param instance the instance to be solved.
+     *********************************************/
+    IHS_Solver(const std::shared_ptr<const Instance> & instance);
+
     /*********************************
      * Constructs a new empty solver.
      *********************************/
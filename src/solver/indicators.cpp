@@ -0,0 +1,309 @@
+#include "solver/indicators.hpp"
+#include <pagmo/utils/hypervolume.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace mofjssp {
+
+// The volume of the box between a minimization point and the
+// reference point, or 0 if the point is not better in every objective
+static double inclusive_hypervolume(const std::vector<double> & reference_point,
+                                    const std::vector<double> & point) {
+    double volume = 1.0;
+
+    for (unsigned i = 0; i < point.size(); i++) {
+        if (point[i] >= reference_point[i]) {
+            return 0.0;
+        }
+
+        volume *= reference_point[i] - point[i];
+    }
+
+    return volume;
+}
+
+// Removes the points weakly dominated by another (keeping one of equal
+// points) and the points outside the reference box
+static void remove_dominated(const std::vector<double> & reference_point,
+                             std::vector<std::vector<double>> & front) {
+    std::vector<std::vector<double>> non_dominated;
+
+    non_dominated.reserve(front.size());
+
+    // After sorting, no point is weakly dominated by a later point
+    std::sort(front.begin(), front.end());
+
+    for (auto & point : front) {
+        bool dominated = inclusive_hypervolume(reference_point, point) == 0.0;
+
+        for (unsigned j = 0; j < non_dominated.size() && !dominated; j++) {
+            dominated = true;
+
+            for (unsigned i = 0; i < point.size() && dominated; i++) {
+                dominated = non_dominated[j][i] <= point[i];
+            }
+        }
+
+        if (!dominated) {
+            non_dominated.push_back(std::move(point));
+        }
+    }
+
+    front = std::move(non_dominated);
+}
+
+double Indicators::exact_hypervolume(const std::vector<double> & reference_point,
+                                     std::vector<std::vector<double>> & front) {
+    double volume = 0.0;
+
+    // Most of the recursive calls are on a single point
+    if (front.size() <= 1) {
+        return front.empty() ? 0.0 :
+                               inclusive_hypervolume(reference_point,
+                                                     front.front());
+    }
+
+    remove_dominated(reference_point, front);
+
+    for (unsigned i = 0; i < front.size(); i++) {
+        // The part of the later points dominated by the i-th one
+        std::vector<std::vector<double>> limit_set(front.size() - i - 1,
+                                                   front[i]);
+
+        for (unsigned j = i + 1; j < front.size(); j++) {
+            for (unsigned k = 0; k < front[i].size(); k++) {
+                limit_set[j - i - 1][k] = std::max(front[i][k], front[j][k]);
+            }
+        }
+
+        volume += inclusive_hypervolume(reference_point, front[i]) -
+                  Indicators::exact_hypervolume(reference_point, limit_set);
+    }
+
+    return volume;
+}
+
+double Indicators::hypervolume(const std::vector<NSBRKGA::Sense> & senses,
+                               const std::vector<double> & reference_point,
+                               const std::vector<std::vector<double>> & front) {
+    std::vector<double> reference_point_prime(reference_point.size());
+    std::vector<std::vector<double>> front_prime(front.size());
+
+    for (unsigned i = 0; i < reference_point.size(); i++) {
+        if (senses[i] == NSBRKGA::Sense::MINIMIZE) {
+            reference_point_prime[i] = reference_point[i];
+        } else {
+            reference_point_prime[i] = -reference_point[i];
+        }
+    }
+
+    for (unsigned i = 0; i < front.size(); i++) {
+        front_prime[i] = std::vector<double>(front[i].size());
+        for (unsigned j = 0; j < front[i].size(); j++) {
+            if (senses[j] == NSBRKGA::Sense::MINIMIZE) {
+                front_prime[i][j] = front[i][j];
+            } else {
+                front_prime[i][j] = -front[i][j];
+            }
+        }
+    }
+
+    pagmo::hypervolume hv(front_prime);
+    return hv.compute(reference_point_prime);
+}
+
+double Indicators::hypervolume_contribution(
+        const std::vector<NSBRKGA::Sense> & senses,
+        const std::vector<double> & reference_point,
+        const std::vector<std::vector<double>> & front,
+        const std::vector<double> & point) {
+    std::vector<double> reference_point_prime(reference_point),
+                        point_prime(point);
+    std::vector<std::vector<double>> limit_set(front);
+
+    for (unsigned i = 0; i < senses.size(); i++) {
+        if (senses[i] == NSBRKGA::Sense::MAXIMIZE) {
+            reference_point_prime[i] = -reference_point[i];
+            point_prime[i] = -point[i];
+        }
+    }
+
+    // The part of the front dominated by the point
+    for (auto & limit : limit_set) {
+        for (unsigned i = 0; i < senses.size(); i++) {
+            if (senses[i] == NSBRKGA::Sense::MAXIMIZE) {
+                limit[i] = -limit[i];
+            }
+
+            limit[i] = std::max(limit[i], point_prime[i]);
+        }
+    }
+
+    return inclusive_hypervolume(reference_point_prime, point_prime) -
+           Indicators::exact_hypervolume(reference_point_prime, limit_set);
+}
+
+std::vector<double> Indicators::minimization_points(
+        const std::vector<NSBRKGA::Sense> & senses,
+        const std::vector<std::vector<double>> & front,
+        bool sorted) {
+    const unsigned num_objectives = senses.size();
+    std::vector<std::size_t> order(front.size());
+    std::vector<double> points(front.size() * num_objectives);
+
+    for(std::size_t j = 0; j < front.size(); j++) {
+        order[j] = j;
+    }
+
+    if(sorted) {
+        std::sort(order.begin(), order.end(),
+                  [&](std::size_t a, std::size_t b) {
+                      return senses[0] == NSBRKGA::Sense::MINIMIZE ?
+                                 front[a][0] < front[b][0] :
+                                 front[a][0] > front[b][0];
+                  });
+    }
+
+    for(std::size_t j = 0; j < front.size(); j++) {
+        for(unsigned k = 0; k < num_objectives; k++) {
+            points[j * num_objectives + k] =
+                senses[k] == NSBRKGA::Sense::MINIMIZE ? front[order[j]][k] :
+                                                        -front[order[j]][k];
+        }
+    }
+
+    return points;
+}
+
+double Indicators::multiplicative_epsilon(
+        const std::vector<NSBRKGA::Sense> & senses,
+        const std::vector<std::vector<double>> & reference_front,
+        const std::vector<std::vector<double>> & front) {
+    return Indicators::sorted_multiplicative_epsilon(
+            senses,
+            Indicators::minimization_points(senses, reference_front, false),
+            Indicators::minimization_points(senses, front, true));
+}
+
+double Indicators::sorted_multiplicative_epsilon(
+        const std::vector<NSBRKGA::Sense> & senses,
+        const std::vector<double> & reference_points,
+        const std::vector<double> & points) {
+    const unsigned num_objectives = senses.size();
+    std::vector<char> minimized(num_objectives);
+    double epsilon = 0.0;
+
+    for(unsigned k = 0; k < num_objectives; k++) {
+        minimized[k] = senses[k] == NSBRKGA::Sense::MINIMIZE;
+    }
+
+    // The ratio of a negated maximization objective is that of the
+    // objective, and the first ratio does not decrease along the points
+    // for any reference point
+    for(std::size_t i = 0; i < reference_points.size(); i += num_objectives) {
+        const double * reference = reference_points.data() + i;
+        double min_max_ratio = std::numeric_limits<double>::infinity();
+
+        // The minimum cannot raise epsilon once it is at most epsilon,
+        // nor be lowered by a point whose first ratio is at least it
+        for(std::size_t j = 0;
+            j < points.size() && min_max_ratio > epsilon;
+            j += num_objectives) {
+            const double * point = points.data() + j;
+            double max_ratio = 0.0;
+
+            if((minimized[0] ? point[0] / reference[0]
+                             : reference[0] / point[0]) >= min_max_ratio) {
+                break;
+            }
+
+            for(unsigned k = 0; k < num_objectives; k++) {
+                const double ratio = minimized[k] ? point[k] / reference[k]
+                                                  : reference[k] / point[k];
+
+                max_ratio = max_ratio < ratio ? ratio : max_ratio;
+            }
+
+            min_max_ratio = std::min(min_max_ratio, max_ratio);
+        }
+
+        epsilon = std::max(epsilon, min_max_ratio);
+    }
+
+    return epsilon;
+}
+
+double Indicators::modified_distance(const std::vector<NSBRKGA::Sense> & senses,
+                                     const std::vector<double> & reference_point,
+                                     const std::vector<double> & point) {
+    double distance = 0.0, delta;
+
+    for(unsigned i = 0; i < senses.size(); i++) {
+        delta = 0;
+
+        if(senses[i] == NSBRKGA::Sense::MINIMIZE) {
+            if(point[i] > reference_point[i]) {
+                delta = point[i] - reference_point[i];
+            }
+        } else { // senses[i] == NSBRKGA::Sense::MAXIMIZE
+            if(reference_point[i] > point[i]) {
+                delta = reference_point[i] - point[i];
+            }
+        }
+
+        distance += delta * delta;
+    }
+
+    return sqrt(distance);
+}
+
+double Indicators::modified_inverted_generational_distance(
+        const std::vector<NSBRKGA::Sense> & senses,
+        const std::vector<std::vector<double>> & reference_front,
+        const std::vector<std::vector<double>> & front) {
+    return Indicators::sorted_modified_inverted_generational_distance(
+            senses,
+            Indicators::minimization_points(senses, reference_front, false),
+            Indicators::minimization_points(senses, front, true));
+}
+
+double Indicators::sorted_modified_inverted_generational_distance(
+        const std::vector<NSBRKGA::Sense> & senses,
+        const std::vector<double> & reference_points,
+        const std::vector<double> & points) {
+    const unsigned num_objectives = senses.size();
+    double igd_plus = 0.0;
+
+    for(std::size_t i = 0; i < reference_points.size(); i += num_objectives) {
+        const double * reference = reference_points.data() + i;
+        double min_squared_distance = std::numeric_limits<double>::infinity();
+
+        // The first delta does not decrease along the points, and bounds
+        // the distance of the remaining points
+        for(std::size_t j = 0; j < points.size(); j += num_objectives) {
+            const double * point = points.data() + j;
+            const double first_delta = std::max(0.0, point[0] - reference[0]);
+            double squared_distance = 0.0;
+
+            if(first_delta * first_delta >= min_squared_distance) {
+                break;
+            }
+
+            for(unsigned k = 0; k < num_objectives; k++) {
+                const double delta = std::max(0.0, point[k] - reference[k]);
+
+                squared_distance += delta * delta;
+            }
+
+            min_squared_distance = std::min(min_squared_distance,
+                                            squared_distance);
+        }
+
+        igd_plus += sqrt(min_squared_distance);
+    }
+
+    return igd_plus / (reference_points.size() / num_objectives);
+}
+
+}
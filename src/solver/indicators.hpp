@@ -0,0 +1,166 @@
+#pragma once
+
+#include "instance/instance.hpp"
+#include <vector>
+
+namespace mofjssp {
+/*********************************************************************
+ * The Indicators class computes the quality indicators with which
+ * the fronts found are compared to a reference front.
+ *********************************************************************/
+class Indicators {
+    public:
+    /*****************************************************************
+     * Computes the hypervolume of a front of minimization points with
+     * the WFG algorithm, i.e., as the sum of the exclusive hypervolume
+     * of each point with respect to the points after it.
+     *
+     * @param reference_point the reference point.
+     * @param front           the front, which may be reordered and
+     *                        from which the dominated points may be
+     *                        removed.
+     *
+     * @return the hypervolume of the front.
+     *****************************************************************/
+    static double exact_hypervolume(
+            const std::vector<double> & reference_point,
+            std::vector<std::vector<double>> & front);
+
+    /*****************************************************************
+     * Computes the hypervolume dominated by a front and bounded by a
+     * reference point.
+     *
+     * @param senses          the optimization senses.
+     * @param reference_point the reference point.
+     * @param front           the front.
+     *
+     * @return the hypervolume of the front.
+     *****************************************************************/
+    static double hypervolume(const std::vector<NSBRKGA::Sense> & senses,
+                              const std::vector<double> & reference_point,
+                              const std::vector<std::vector<double>> & front);
+
+    /*****************************************************************
+     * Computes the hypervolume dominated by a point and by no point of
+     * a front, and bounded by a reference point, without the
+     * dependencies of hypervolume. Adding (removing) the point to (from)
+     * the front adds (removes) this much hypervolume, even if the
+     * point dominates or is dominated by points of the front.
+     *
+     * @param senses          the optimization senses.
+     * @param reference_point the reference point.
+     * @param front           the front.
+     * @param point           the point.
+     *
+     * @return the exclusive hypervolume of the point.
+     *****************************************************************/
+    static double hypervolume_contribution(
+            const std::vector<NSBRKGA::Sense> & senses,
+            const std::vector<double> & reference_point,
+            const std::vector<std::vector<double>> & front,
+            const std::vector<double> & point);
+
+    /*****************************************************************
+     * Returns the points of a front row after row, with the
+     * maximization objectives negated.
+     *
+     * @param senses the optimization senses.
+     * @param front  the front.
+     * @param sorted whether the points are sorted by their first
+     *               objective, from the best to the worst.
+     *
+     * @return the points of the front.
+     *****************************************************************/
+    static std::vector<double> minimization_points(
+            const std::vector<NSBRKGA::Sense> & senses,
+            const std::vector<std::vector<double>> & front,
+            bool sorted);
+
+    /*****************************************************************
+     * Computes the multiplicative epsilon indicator of a front, i.e.,
+     * the smallest factor by which the front must be scaled to weakly
+     * dominate the reference front.
+     *
+     * @param senses          the optimization senses.
+     * @param reference_front the reference front.
+     * @param front           the front.
+     *
+     * @return the multiplicative epsilon of the front, or infinity if
+     *         the front is empty and the reference front is not.
+     *****************************************************************/
+    static double multiplicative_epsilon(
+            const std::vector<NSBRKGA::Sense> & senses,
+            const std::vector<std::vector<double>> & reference_front,
+            const std::vector<std::vector<double>> & front);
+
+    /*****************************************************************
+     * Computes the multiplicative epsilon indicator of the sorted
+     * minimization points of a front. As the points are sorted, the
+     * search for the point of least ratio to a reference point stops
+     * once no later point can have a lesser ratio, or once the ratio
+     * cannot raise the indicator.
+     *
+     * @param senses           the optimization senses.
+     * @param reference_points the minimization points of the reference
+     *                         front.
+     * @param points           the sorted minimization points of the
+     *                         front.
+     *
+     * @return the multiplicative epsilon of the front.
+     *****************************************************************/
+    static double sorted_multiplicative_epsilon(
+            const std::vector<NSBRKGA::Sense> & senses,
+            const std::vector<double> & reference_points,
+            const std::vector<double> & points);
+
+    /*****************************************************************
+     * Computes the modified distance from a reference point to a
+     * point, which only accounts for the objectives in which the point
+     * is worse.
+     *
+     * @param senses          the optimization senses.
+     * @param reference_point the reference point.
+     * @param point           the point.
+     *
+     * @return the modified distance.
+     *****************************************************************/
+    static double modified_distance(const std::vector<NSBRKGA::Sense> & senses,
+                                    const std::vector<double> & reference_point,
+                                    const std::vector<double> & point);
+
+    /*****************************************************************
+     * Computes the modified inverted generational distance (IGD+) of
+     * a front, i.e., the mean modified distance from each point of the
+     * reference front to the front.
+     *
+     * @param senses          the optimization senses.
+     * @param reference_front the reference front.
+     * @param front           the front.
+     *
+     * @return the IGD+ of the front.
+     *****************************************************************/
+    static double modified_inverted_generational_distance(
+            const std::vector<NSBRKGA::Sense> & senses,
+            const std::vector<std::vector<double>> & reference_front,
+            const std::vector<std::vector<double>> & front);
+
+    /*****************************************************************
+     * Computes the IGD+ of the sorted minimization points of a front.
+     * As the points are sorted, the search for the point nearest to a
+     * reference point stops once no later point can be nearer.
+     *
+     * @param senses           the optimization senses.
+     * @param reference_points the minimization points of the reference
+     *                         front, in the order of the sum.
+     * @param points           the sorted minimization points of the
+     *                         front.
+     *
+     * @return the IGD+ of the front, or infinity if it is empty.
+     *****************************************************************/
+    static double sorted_modified_inverted_generational_distance(
+            const std::vector<NSBRKGA::Sense> & senses,
+            const std::vector<double> & reference_points,
+            const std::vector<double> & points);
+};
+
+}
@@ -0,0 +1,390 @@
+#include "solver/local_search.hpp"
+#include <algorithm>
+#include <numeric>
+#include <queue>
+
+namespace mofjssp {
+
+Local_Search::Local_Search(const Instance & instance)
+    : instance(instance),
+      first_gene_of_job(instance.num_jobs),
+      job_of_gene(instance.total_num_operations),
+      operation_of_gene(instance.total_num_operations),
+      sequence_of_machine(instance.num_machines),
+      machine(instance.total_num_operations),
+      position(instance.total_num_operations),
+      head(instance.total_num_operations),
+      processing_time(instance.total_num_operations),
+      tail(instance.total_num_operations),
+      release(instance.total_num_operations) {
+    this->block.reserve(instance.total_num_operations);
+    this->order.reserve(instance.total_num_operations);
+
+    for (unsigned job = 0, i = 0; job < this->instance.num_jobs; job++) {
+        this->first_gene_of_job[job] = i;
+
+        for (unsigned operation = 0;
+             operation < this->instance.num_operations[job];
+             operation++, i++) {
+            this->job_of_gene[i] = job;
+            this->operation_of_gene[i] = operation;
+        }
+    }
+}
+
+void Local_Search::load(Solution && solution) {
+    this->solution = std::make_unique<Solution>(std::move(solution));
+
+    for (unsigned machine = 0;
+         machine < this->instance.num_machines;
+         machine++) {
+        std::vector<unsigned> & sequence = this->sequence_of_machine[machine];
+
+        sequence.clear();
+
+        for (const auto & [job, operation] :
+                this->solution->operations_of_machine[machine]) {
+            const unsigned gene = this->first_gene_of_job[job] + operation;
+
+            this->machine[gene] = machine;
+            this->position[gene] = sequence.size();
+            this->head[gene] =
+                this->solution->starting_time_of_operation[job][operation];
+            this->processing_time[gene] =
+                this->solution->ending_time_of_operation[job][operation] -
+                this->head[gene];
+            sequence.push_back(gene);
+        }
+    }
+
+    // Computes the tails from the last operation to start to the first
+    std::vector<unsigned> genes(this->instance.total_num_operations);
+
+    std::iota(genes.begin(), genes.end(), 0);
+    std::sort(genes.begin(), genes.end(),
+              [this](unsigned a, unsigned b) {
+                  return this->head[a] > this->head[b];
+              });
+
+    for (const unsigned & gene : genes) {
+        const std::vector<unsigned> & sequence =
+            this->sequence_of_machine[this->machine[gene]];
+
+        this->tail[gene] = this->job_tail(gene);
+
+        if (this->position[gene] + 1 < sequence.size()) {
+            const unsigned successor = sequence[this->position[gene] + 1];
+
+            this->tail[gene] = std::max(this->tail[gene],
+                                        this->tail[successor] +
+                                        this->processing_time[successor]);
+        }
+    }
+}
+
+double Local_Search::job_release(unsigned gene) const {
+    if (this->operation_of_gene[gene] == 0) {
+        return 0.0;
+    }
+
+    return this->head[gene - 1] + this->processing_time[gene - 1];
+}
+
+double Local_Search::job_tail(unsigned gene) const {
+    if (this->operation_of_gene[gene] + 1 ==
+            this->instance.num_operations[this->job_of_gene[gene]]) {
+        return 0.0;
+    }
+
+    return this->tail[gene + 1] + this->processing_time[gene + 1];
+}
+
+double Local_Search::estimate(const unsigned * order,
+                              std::size_t size,
+                              unsigned before,
+                              unsigned after) {
+    std::vector<double> & release = this->release;
+    double time = before == none ? 0.0 :
+                  this->head[before] + this->processing_time[before],
+           tail = after == none ? 0.0 :
+                  this->tail[after] + this->processing_time[after],
+           makespan = 0.0;
+
+    for (std::size_t i = 0; i < size; i++) {
+        release[i] = std::max(time, this->job_release(order[i]));
+        time = release[i] + this->processing_time[order[i]];
+    }
+
+    for (std::size_t i = size; i-- > 0;) {
+        tail = std::max(tail, this->job_tail(order[i]));
+        makespan = std::max(makespan,
+                            release[i] + this->processing_time[order[i]] +
+                            tail);
+        tail += this->processing_time[order[i]];
+    }
+
+    return makespan;
+}
+
+std::vector<Local_Search::Move> Local_Search::moves() {
+    const std::vector<std::pair<unsigned, unsigned>> path =
+        this->solution->critical_path();
+    const double makespan = this->solution->value[0];
+    std::vector<Move> moves;
+
+    for (std::size_t first = 0, last = 0; first < path.size(); first = last) {
+        // Finds the critical block starting at first
+        std::vector<unsigned> & block = this->block;
+
+        block.clear();
+
+        for (last = first;
+             last < path.size() &&
+                this->machine[this->first_gene_of_job[path[last].first] +
+                              path[last].second] ==
+                this->machine[this->first_gene_of_job[path[first].first] +
+                              path[first].second];
+             last++) {
+            block.push_back(this->first_gene_of_job[path[last].first] +
+                            path[last].second);
+        }
+
+        const unsigned machine = this->machine[block.front()];
+        const std::vector<unsigned> & sequence =
+            this->sequence_of_machine[machine];
+        const unsigned before = this->position[block.front()] > 0 ?
+                                sequence[this->position[block.front()] - 1] :
+                                none,
+                       after = this->position[block.back()] + 1 <
+                                    sequence.size() ?
+                               sequence[this->position[block.back()] + 1] :
+                               none;
+
+        // Moves each operation of the block to its front or its back,
+        // which swaps its first two or last two operations when adjacent
+        for (std::size_t i = 0; i < block.size(); i++) {
+            if (i > 0) {
+                this->order.assign(1, block[i]);
+                this->order.insert(this->order.end(),
+                                   block.begin(),
+                                   block.begin() + i);
+
+                const double value = this->estimate(this->order.data(),
+                        this->order.size(),
+                        before,
+                        i + 1 < block.size() ? block[i + 1] : after);
+
+                if (value <= makespan) {
+                    moves.push_back({value,
+                                     block[i],
+                                     machine,
+                                     this->position[block.front()]});
+                }
+            }
+
+            if (i + 1 < block.size() && (i > 0 || block.size() > 2)) {
+                this->order.assign(block.begin() + i + 1, block.end());
+                this->order.push_back(block[i]);
+
+                const double value = this->estimate(this->order.data(),
+                        this->order.size(),
+                        i > 0 ? block[i - 1] : before,
+                        after);
+
+                if (value <= makespan) {
+                    moves.push_back({value,
+                                     block[i],
+                                     machine,
+                                     this->position[block.back()]});
+                }
+            }
+        }
+
+        // Reassigns each operation of the block to another machine,
+        // where it is inserted by its current starting time
+        for (const unsigned & gene : block) {
+            const unsigned job = this->job_of_gene[gene],
+                           operation = this->operation_of_gene[gene];
+
+            for (const unsigned & other_machine :
+                    this->instance.machines_of_operation[job][operation]) {
+                if (other_machine == machine) {
+                    continue;
+                }
+
+                const std::vector<unsigned> & other_sequence =
+                    this->sequence_of_machine[other_machine];
+                const double other_processing_time =
+                    this->instance.processing_time.at(
+                            std::make_tuple(job, operation, other_machine));
+                // The sequence is ordered by starting time
+                const unsigned index = std::partition_point(
+                        other_sequence.begin(),
+                        other_sequence.end(),
+                        [this, gene](unsigned other_gene) {
+                            return this->head[other_gene] < this->head[gene];
+                        }) - other_sequence.begin();
+
+                const double value = this->estimate(
+                        &gene,
+                        1,
+                        index > 0 ? other_sequence[index - 1] : none,
+                        index < other_sequence.size() ?
+                            other_sequence[index] : none) -
+                    this->processing_time[gene] + other_processing_time;
+
+                if (value < makespan ||
+                        (value <= makespan &&
+                         other_processing_time < this->processing_time[gene])) {
+                    moves.push_back({value, gene, other_machine, index});
+                }
+            }
+        }
+    }
+
+    std::stable_sort(moves.begin(), moves.end(),
+                     [](const Move & a, const Move & b) {
+                         return a.estimate < b.estimate;
+                     });
+
+    return moves;
+}
+
+std::unique_ptr<Solution> Local_Search::apply(const Move & move) const {
+    const unsigned total_num_operations = this->instance.total_num_operations;
+    std::vector<std::vector<unsigned>> sequence_of_machine =
+        this->sequence_of_machine;
+    std::vector<unsigned> & from = sequence_of_machine[this->machine[move.gene]],
+                          & to = sequence_of_machine[move.machine];
+
+    from.erase(from.begin() + this->position[move.gene]);
+    to.insert(to.begin() + move.index, move.gene);
+
+    // Sequences the operations in a topological order of the job and
+    // machine precedences, if the move does not create a cycle
+    std::vector<unsigned> num_predecessors(total_num_operations, 0),
+                          machine_successor(total_num_operations, none),
+                          order;
+    std::queue<unsigned> ready;
+
+    order.reserve(total_num_operations);
+
+    for (const std::vector<unsigned> & sequence : sequence_of_machine) {
+        for (std::size_t i = 1; i < sequence.size(); i++) {
+            machine_successor[sequence[i - 1]] = sequence[i];
+            num_predecessors[sequence[i]]++;
+        }
+    }
+
+    for (unsigned gene = 0; gene < total_num_operations; gene++) {
+        if (this->operation_of_gene[gene] > 0) {
+            num_predecessors[gene]++;
+        }
+
+        if (num_predecessors[gene] == 0) {
+            ready.push(gene);
+        }
+    }
+
+    while (!ready.empty()) {
+        const unsigned gene = ready.front();
+
+        ready.pop();
+        order.push_back(gene);
+
+        if (this->operation_of_gene[gene] + 1 <
+                this->instance.num_operations[this->job_of_gene[gene]] &&
+                --num_predecessors[gene + 1] == 0) {
+            ready.push(gene + 1);
+        }
+
+        if (machine_successor[gene] != none &&
+                --num_predecessors[machine_successor[gene]] == 0) {
+            ready.push(machine_successor[gene]);
+        }
+    }
+
+    if (order.size() < total_num_operations) {
+        return nullptr;
+    }
+
+    auto solution = std::make_unique<Solution>(this->instance);
+    std::vector<std::pair<double, unsigned>> permutation(total_num_operations);
+
+    for (unsigned machine = 0;
+         machine < this->instance.num_machines;
+         machine++) {
+        for (const unsigned & gene : sequence_of_machine[machine]) {
+            solution->machine_of_operation[this->job_of_gene[gene]]
+                                          [this->operation_of_gene[gene]] =
+                machine;
+        }
+    }
+
+    for (unsigned i = 0; i < total_num_operations; i++) {
+        permutation[i] = std::make_pair(i, this->job_of_gene[order[i]]);
+    }
+
+    solution->schedule(permutation);
+
+    return solution;
+}
+
+bool Local_Search::improve(std::vector<double> & key,
+                           std::vector<double> & value) {
+    unsigned num_evaluations = 0;
+    bool improved = false,
+         found = true;
+
+    std::vector<double> current_key = key;
+
+    this->load(Solution(this->instance, key, this->active));
+
+    while (found && num_evaluations < this->max_num_evaluations) {
+        found = false;
+
+        for (const Move & move : this->moves()) {
+            if (num_evaluations >= this->max_num_evaluations) {
+                break;
+            }
+
+            std::unique_ptr<Solution> solution = this->apply(move);
+
+            num_evaluations++;
+
+            if (!solution) {
+                continue;
+            }
+
+            std::vector<double> solution_key = solution->key();
+
+            // The active schedule of the key may differ from the move's
+            if (this->active) {
+                solution = std::make_unique<Solution>(this->instance,
+                                                      solution_key,
+                                                      true);
+            }
+
+            if (Solution::dominates(solution->value,
+                                    this->solution->value)) {
+                this->load(std::move(*solution));
+                current_key = std::move(solution_key);
+                this->num_improvements++;
+                improved = found = true;
+                break;
+            }
+        }
+    }
+
+    this->num_evaluations += num_evaluations;
+
+    if (improved) {
+        key = std::move(current_key);
+        value.assign(this->solution->value.begin(),
+                     this->solution->value.end());
+    }
+
+    return improved;
+}
+
+}
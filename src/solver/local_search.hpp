@@ -0,0 +1,176 @@
+#pragma once
+
+#include "solution/solution.hpp"
+#include <limits>
+#include <memory>
+
+namespace mofjssp {
+/******************************************************************
+ * The Local_Search class represents a first-improvement local
+ * search on the critical path of a solution, with the moves:
+ * - swapping the first two or the last two operations of a
+ *   critical block (N5);
+ * - moving an operation of a critical block to the front or to
+ *   the back of the block (N6);
+ * - reassigning a critical operation to another machine.
+ *
+ * The makespan after each move is estimated from the heads and
+ * tails of the operations, in O(1) for swaps, O(log m) for
+ * reassignments and O(k) for the other moves, without allocating,
+ * and only promising moves are evaluated exactly.
+ * A move is accepted if the new solution dominates the current.
+ * If the schedules are active, the solution after a move is the
+ * active schedule of its key.
+ ******************************************************************/
+class Local_Search {
+    public:
+    /*****************************
+     * The instance been solved.
+     *****************************/
+    const Instance & instance;
+
+    /*****************************************************************
+     * The maximum number of exact evaluations per improvement call.
+     *****************************************************************/
+    unsigned max_num_evaluations = 200;
+
+    /**********************************************************
+     * Whether the keys are decoded into active schedules.
+     **********************************************************/
+    bool active = false;
+
+    /**********************************************
+     * The number of exact evaluations performed.
+     **********************************************/
+    unsigned num_evaluations = 0;
+
+    /***************************************
+     * The number of moves accepted.
+     ***************************************/
+    unsigned num_improvements = 0;
+
+    private:
+    /***************************************************************
+     * A move of an operation (gene) to the given index of the
+     * sequence of the given machine, after its removal from its
+     * current sequence.
+     ***************************************************************/
+    struct Move {
+        double estimate;
+        unsigned gene;
+        unsigned machine;
+        unsigned index;
+    };
+
+    /*******************************************
+     * Marks the absence of an operation.
+     *******************************************/
+    static constexpr unsigned none = std::numeric_limits<unsigned>::max();
+
+    /*****************************************************
+     * The first gene of each job, i.e., the index of its
+     * first operation in each half of a key.
+     *****************************************************/
+    std::vector<unsigned> first_gene_of_job;
+
+    /**************************************
+     * The job and operation of each gene.
+     **************************************/
+    std::vector<unsigned> job_of_gene, operation_of_gene;
+
+    /*********************************************************************
+     * The current solution, the sequence of operations (genes) of each
+     * machine and, for each operation, its machine, its index in the
+     * sequence of its machine, its head (starting time), its processing
+     * time and its tail (the longest path from its end to the makespan).
+     *********************************************************************/
+    std::unique_ptr<Solution> solution;
+
+    std::vector<std::vector<unsigned>> sequence_of_machine;
+
+    std::vector<unsigned> machine, position;
+
+    std::vector<double> head, processing_time, tail;
+
+    /*****************************************************************
+     * Scratch buffers of the estimates, reserved for the longest
+     * sequence: the current critical block, the new order of a
+     * segment and the release times of its operations.
+     *****************************************************************/
+    std::vector<unsigned> block, order;
+
+    std::vector<double> release;
+
+    /*******************************************************
+     * Loads the arrays of a solution into this search.
+     *
+     * @param solution the solution.
+     *******************************************************/
+    void load(Solution && solution);
+
+    /*****************************************************************
+     * Returns the end of the job predecessor of a gene (0 if none).
+     *****************************************************************/
+    double job_release(unsigned gene) const;
+
+    /******************************************************************
+     * Returns the tail through the job successor of a gene (0 if none).
+     ******************************************************************/
+    double job_tail(unsigned gene) const;
+
+    /*****************************************************************
+     * Estimates the makespan after reordering a segment of
+     * consecutive operations of a machine.
+     *
+     * @param order  the new order of the operations of the segment.
+     * @param size   the number of operations of the segment.
+     * @param before the operation preceding the segment, if any.
+     * @param after  the operation following the segment, if any.
+     *
+     * @return the estimated makespan.
+     *****************************************************************/
+    double estimate(const unsigned * order,
+                    std::size_t size,
+                    unsigned before,
+                    unsigned after);
+
+    /***********************************************************
+     * Collects the moves whose estimates are promising.
+     *
+     * @return the moves, from the most to the least promising.
+     ***********************************************************/
+    std::vector<Move> moves();
+
+    /*************************************************************
+     * Evaluates a move exactly.
+     *
+     * @param move the move.
+     *
+     * @return the solution after the move, or none if the move
+     *         is not realizable.
+     *************************************************************/
+    std::unique_ptr<Solution> apply(const Move & move) const;
+
+    public:
+    /*************************************************
+     * Constructs a new local search.
+     *
+     * @param instance the instance been solved.
+     *************************************************/
+    Local_Search(const Instance & instance);
+
+    /*******************************************************************
+     * Improves a solution, given by its key, until no move improves it
+     * or the evaluations are exhausted.
+     *
+     * @param key   the key of the solution, replaced by the key of the
+     *              improved solution.
+     * @param value the value of the solution, replaced by the value of
+     *              the improved solution.
+     *
+     * @return true if the solution was improved; false otherwise.
+     *******************************************************************/
+    bool improve(std::vector<double> & key, std::vector<double> & value);
+};
+
+}
@@ -1,5 +1,5 @@
 #include "solver/mhaco/mhaco_solver.hpp"
-#include "solver/mhaco/problem.hpp"
+#include "solver/problem.hpp"
 #include <pagmo/algorithms/maco.hpp>
 
 namespace mofjssp {
@@ -7,12 +7,19 @@ namespace mofjssp {
 MHACO_Solver::MHACO_Solver(const Instance & instance)
     : Solver::Solver(instance) {}
 
+MHACO_Solver::MHACO_Solver(const std::shared_ptr<const Instance> & instance)
+    : Solver::Solver(instance) {}
+
 MHACO_Solver::MHACO_Solver() = default;
 
 void MHACO_Solver::solve() {
     this->start_time = std::chrono::steady_clock::now();
+    this->reset_decode_cache();
 
-    pagmo::problem prob{Problem(this->instance)};
+    pagmo::problem prob{Problem(this->instance,
+                                this->decode_cache,
+                                this->active_schedule,
+                                this->key_precision)};
 
     pagmo::algorithm algo{pagmo::maco(1,
                                       this->ker,
@@ -29,8 +36,9 @@ void MHACO_Solver::solve() {
         this->population_size - this->initial_individuals.size(),
         this->seed};
 
-    for(const auto & individual : this->initial_individuals) {
-        pop.push_back(individual.second, individual.first);
+    for(std::size_t i = 0; i < this->initial_individuals.size(); i++) {
+        pop.push_back(this->initial_individuals.key(i),
+                      this->initial_individuals.value(i).vector());
     }
 
     this->update_best_individuals(pop);
@@ -62,9 +70,19 @@ void MHACO_Solver::solve() {
 
     while(!this->are_termination_criteria_met()) {
         this->num_iterations++;
-        pop = algo.evolve(pop);
+
+        {
+            MOFJSSP_PROFILE_SCOPE(EVOLVE);
+            pop = algo.evolve(pop);
+        }
+
         this->update_best_individuals(pop);
 
+        if (this->local_search_interval > 0 &&
+                this->num_iterations % this->local_search_interval == 0) {
+            this->improve_best_individuals(pop);
+        }
+
         if(this->max_num_snapshots > this->num_snapshots + 1) {
             if (this->num_iterations >= this->iteration_next_snapshot) {
                 this->capture_snapshot(pop);
@@ -98,13 +116,12 @@ void MHACO_Solver::solve() {
         this->capture_snapshot(pop);
     }
 
-    this->best_solutions.clear();
-
-    for(const auto & best_individual : this->best_individuals) {
-        this->best_solutions.push_back(Solution(this->instance,
-                                                best_individual.second));
+    if (this->local_search) {
+        this->improve_best_individuals();
     }
 
+    this->materialize_best_solutions();
+
     this->solving_time = this->elapsed_time();
 }
 
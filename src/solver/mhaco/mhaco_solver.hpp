@@ -72,6 +72,13 @@ class MHACO_Solver : public Solver {
      *********************************************/
     MHACO_Solver(const Instance & instance);
 
+    /*********************************************
+     * Constructs a new solver.
+     *
+     * @param instance the instance to be solved.
+     *********************************************/
+    MHACO_Solver(const std::shared_ptr<const Instance> & instance);
+
     /*********************************
      * Constructs a new empty solver.
      *********************************/
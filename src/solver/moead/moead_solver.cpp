@@ -1,5 +1,5 @@
 #include "solver/moead/moead_solver.hpp"
-#include "solver/moead/problem.hpp"
+#include "solver/problem.hpp"
 #include <pagmo/algorithms/moead.hpp>
 
 namespace mofjssp {
@@ -7,12 +7,19 @@ namespace mofjssp {
 MOEAD_Solver::MOEAD_Solver(const Instance & instance)
     : Solver::Solver(instance) {}
 
+MOEAD_Solver::MOEAD_Solver(const std::shared_ptr<const Instance> & instance)
+    : Solver::Solver(instance) {}
+
 MOEAD_Solver::MOEAD_Solver() = default;
 
 void MOEAD_Solver::solve() {
     this->start_time = std::chrono::steady_clock::now();
+    this->reset_decode_cache();
 
-    pagmo::problem prob{Problem(this->instance)};
+    pagmo::problem prob{Problem(this->instance,
+                                this->decode_cache,
+                                this->active_schedule,
+                                this->key_precision)};
 
     pagmo::algorithm algo{pagmo::moead(1,
                                        this->weight_generation,
@@ -31,8 +38,9 @@ void MOEAD_Solver::solve() {
         this->population_size - this->initial_individuals.size(),
         this->seed};
 
-    for(const auto & individual : this->initial_individuals) {
-        pop.push_back(individual.second, individual.first);
+    for(std::size_t i = 0; i < this->initial_individuals.size(); i++) {
+        pop.push_back(this->initial_individuals.key(i),
+                      this->initial_individuals.value(i).vector());
     }
 
     this->update_best_individuals(pop);
@@ -64,9 +72,19 @@ void MOEAD_Solver::solve() {
 
     while(!this->are_termination_criteria_met()) {
         this->num_iterations++;
-        pop = algo.evolve(pop);
+
+        {
+            MOFJSSP_PROFILE_SCOPE(EVOLVE);
+            pop = algo.evolve(pop);
+        }
+
         this->update_best_individuals(pop);
 
+        if (this->local_search_interval > 0 &&
+                this->num_iterations % this->local_search_interval == 0) {
+            this->improve_best_individuals(pop);
+        }
+
         if(this->max_num_snapshots > this->num_snapshots + 1) {
             if (this->num_iterations >= this->iteration_next_snapshot) {
                 this->capture_snapshot(pop);
@@ -100,13 +118,12 @@ void MOEAD_Solver::solve() {
         this->capture_snapshot(pop);
     }
 
-    this->best_solutions.clear();
-
-    for(const auto & best_individual : this->best_individuals) {
-        this->best_solutions.push_back(Solution(this->instance,
-                                                best_individual.second));
+    if (this->local_search) {
+        this->improve_best_individuals();
     }
 
+    this->materialize_best_solutions();
+
     this->solving_time = this->elapsed_time();
 }
 
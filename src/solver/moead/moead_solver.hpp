@@ -71,6 +71,13 @@ class MOEAD_Solver : public Solver {
      *********************************************/
     MOEAD_Solver(const Instance & instance);
 
+    /*********************************************
+     * Constructs a new solver.
+     *
+     * @param instance the instance to be solved.
+     *********************************************/
+    MOEAD_Solver(const std::shared_ptr<const Instance> & instance);
+
     /*********************************
      * Constructs a new empty solver.
      *********************************/
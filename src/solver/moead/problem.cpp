@@ -1,26 +0,0 @@
-#include "solver/nsga2/problem.hpp"
-#include "solution/solution.hpp"
-
-namespace mofjssp {
-
-Problem::Problem(const Instance & instance) : instance(instance) {}
-
-Problem::Problem() {}
-
-pagmo::vector_double Problem::fitness(const pagmo::vector_double & dv) const {
-    Solution solution(this->instance, dv);
-    return solution.value;
-}
-
-std::pair<pagmo::vector_double, pagmo::vector_double> Problem::get_bounds()
-    const {
-    return std::make_pair(
-            pagmo::vector_double(2 * this->instance.total_num_operations, 0.0),
-            pagmo::vector_double(2 * this->instance.total_num_operations, 1.0));
-}
-
-pagmo::vector_double::size_type Problem::get_nobj() const {
-    return this->instance.num_objectives;
-}
-
-}
@@ -0,0 +1,138 @@
+#include "solver/non_dominated_sort.hpp"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace mofjssp {
+
+Objective_Matrix::Objective_Matrix(const std::vector<NSBRKGA::Sense> & senses)
+    : senses(senses), columns(senses.size()) {}
+
+std::size_t Objective_Matrix::size() const {
+    return this->columns.empty() ? 0 : this->columns.front().size();
+}
+
+void Objective_Matrix::push_back(const std::vector<double> & value) {
+    for (std::size_t k = 0; k < this->columns.size(); k++) {
+        this->columns[k].push_back(
+                this->senses[k] == NSBRKGA::Sense::MAXIMIZE ? -value[k] :
+                                                              value[k]);
+    }
+}
+
+void Objective_Matrix::get(std::size_t i, std::vector<double> & value) const {
+    value.resize(this->columns.size());
+
+    for (std::size_t k = 0; k < this->columns.size(); k++) {
+        value[k] = this->columns[k][i];
+    }
+}
+
+bool Objective_Matrix::dominates(const std::vector<double> & value) const {
+    // The points are compared in blocks, objective by objective, so that
+    // the comparisons of a block are vectorized over its points
+    constexpr std::size_t block_size = 64;
+    const std::size_t size = this->size();
+
+    for (std::size_t first = 0; first < size; first += block_size) {
+        const std::size_t last = std::min(size, first + block_size);
+        unsigned char at_least_as_good[block_size],
+                      better[block_size];
+
+        std::fill(at_least_as_good, at_least_as_good + block_size, 1);
+        std::fill(better, better + block_size, 0);
+
+        for (std::size_t k = 0; k < this->columns.size(); k++) {
+            const double * column = this->columns[k].data();
+            const double upper = value[k] +
+                                 std::numeric_limits<double>::epsilon(),
+                         lower = value[k] -
+                                 std::numeric_limits<double>::epsilon();
+
+            for (std::size_t i = first; i < last; i++) {
+                at_least_as_good[i - first] &= column[i] <= upper;
+                better[i - first] |= column[i] < lower;
+            }
+        }
+
+        unsigned char dominates = 0;
+
+        for (std::size_t i = 0; i < last - first; i++) {
+            dominates |= at_least_as_good[i] & better[i];
+        }
+
+        if (dominates) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::vector<std::vector<std::size_t>> Non_Dominated_Sort::sort(
+        const Objective_Matrix & values,
+        bool only_first_front) {
+    const std::size_t num_objectives = values.columns.size();
+    std::vector<std::size_t> order(values.size());
+    std::vector<std::vector<std::size_t>> fronts;
+    std::vector<Objective_Matrix> values_of_fronts;
+    std::vector<double> value;
+
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&values, num_objectives](std::size_t a, std::size_t b) {
+                  for (std::size_t k = 0; k < num_objectives; k++) {
+                      if (values.columns[k][a] != values.columns[k][b]) {
+                          return values.columns[k][a] < values.columns[k][b];
+                      }
+                  }
+
+                  return a < b;
+              });
+
+    for (const std::size_t & i : order) {
+        values.get(i, value);
+
+        // Finds the first front with no point dominating this one,
+        // since a point dominated by a front is dominated by the
+        // fronts before it
+        std::size_t first = 0, last = fronts.size();
+
+        if (only_first_front) {
+            last = std::min<std::size_t>(last, 1);
+        }
+
+        while (first < last) {
+            const std::size_t middle = first + (last - first) / 2;
+
+            if (values_of_fronts[middle].dominates(value)) {
+                first = middle + 1;
+            } else {
+                last = middle;
+            }
+        }
+
+        if (first == fronts.size()) {
+            if (only_first_front && first > 0) {
+                continue;
+            }
+
+            fronts.emplace_back();
+            values_of_fronts.emplace_back(
+                    std::vector<NSBRKGA::Sense>(num_objectives,
+                                                NSBRKGA::Sense::MINIMIZE));
+        }
+
+        fronts[first].push_back(i);
+        values_of_fronts[first].push_back(value);
+    }
+
+    // Keeps the points of each front in their original order
+    for (auto & front : fronts) {
+        std::sort(front.begin(), front.end());
+    }
+
+    return fronts;
+}
+
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "nsbrkga.hpp"
+#include <vector>
+
+namespace mofjssp {
+/*********************************************************************
+ * The Objective_Matrix class represents the objective values of a
+ * set of points as a structure of arrays, with one contiguous column
+ * per objective, so that a point is compared with many points at
+ * once. Maximized objectives are negated, so that every objective is
+ * minimized.
+ *********************************************************************/
+class Objective_Matrix {
+    public:
+    /*****************************************
+     * The optimisation senses.
+     *****************************************/
+    std::vector<NSBRKGA::Sense> senses;
+
+    /***********************************************
+     * The values of each objective of each point.
+     ***********************************************/
+    std::vector<std::vector<double>> columns;
+
+    /**********************************************
+     * Constructs a new empty objective matrix.
+     *
+     * @param senses the optimisation senses.
+     **********************************************/
+    Objective_Matrix(const std::vector<NSBRKGA::Sense> & senses);
+
+    /***************************************
+     * Returns the number of points.
+     *
+     * @return the number of points.
+     ***************************************/
+    std::size_t size() const;
+
+    /*******************************************
+     * Appends a point.
+     *
+     * @param value the objective values of the point.
+     *******************************************/
+    void push_back(const std::vector<double> & value);
+
+    /*******************************************************************
+     * Returns the (signed) objective values of a point.
+     *
+     * @param i     the index of the point.
+     * @param value the signed objective values of the point.
+     *******************************************************************/
+    void get(std::size_t i, std::vector<double> & value) const;
+
+    /*******************************************************************
+     * Verifies whether any point of this matrix dominates the given
+     * (signed) objective values.
+     *
+     * @param value the signed objective values.
+     *
+     * @return true if a point dominates the values; false otherwise.
+     *******************************************************************/
+    bool dominates(const std::vector<double> & value) const;
+};
+
+/*********************************************************************
+ * The Non_Dominated_Sort class implements the efficient non-dominated
+ * sort with binary search (ENS-BS): the points are sorted
+ * lexicographically, so that a point can only be dominated by the
+ * points before it, and each point is placed in the first front with
+ * no point dominating it, found by a binary search over the fronts.
+ *********************************************************************/
+class Non_Dominated_Sort {
+    public:
+    /*******************************************************************
+     * Sorts points into non-dominated fronts.
+     *
+     * @param values           the objective values of the points.
+     * @param only_first_front whether only the first front is computed.
+     *
+     * @return the indices of the points of each front.
+     *******************************************************************/
+    static std::vector<std::vector<std::size_t>> sort(
+            const Objective_Matrix & values,
+            bool only_first_front = false);
+
+    /*******************************************************************
+     * Sorts individuals into non-dominated fronts.
+     *
+     * @param individuals the (value, key) pairs of the individuals.
+     * @param senses      the optimisation senses.
+     *
+     * @return the individuals of each front.
+     *******************************************************************/
+    template <class T>
+    static std::vector<std::vector<std::pair<std::vector<double>, T>>> sort(
+            const std::vector<std::pair<std::vector<double>, T>> & individuals,
+            const std::vector<NSBRKGA::Sense> & senses,
+            bool only_first_front = false) {
+        Objective_Matrix values(senses);
+
+        for (const auto & individual : individuals) {
+            values.push_back(individual.first);
+        }
+
+        const auto fronts = Non_Dominated_Sort::sort(values, only_first_front);
+        std::vector<std::vector<std::pair<std::vector<double>, T>>>
+            individuals_of_fronts(fronts.size());
+
+        for (std::size_t i = 0; i < fronts.size(); i++) {
+            individuals_of_fronts[i].reserve(fronts[i].size());
+
+            for (const std::size_t & j : fronts[i]) {
+                individuals_of_fronts[i].push_back(individuals[j]);
+            }
+        }
+
+        return individuals_of_fronts;
+    }
+
+    /*******************************************************************
+     * Returns the non-dominated individuals.
+     *
+     * @param individuals the (value, key) pairs of the individuals.
+     * @param senses      the optimisation senses.
+     *
+     * @return the non-dominated individuals.
+     *******************************************************************/
+    template <class T>
+    static std::vector<std::pair<std::vector<double>, T>> first_front(
+            const std::vector<std::pair<std::vector<double>, T>> & individuals,
+            const std::vector<NSBRKGA::Sense> & senses) {
+        auto fronts = Non_Dominated_Sort::sort(individuals, senses, true);
+
+        if (fronts.empty()) {
+            return {};
+        }
+
+        return std::move(fronts.front());
+    }
+};
+
+}
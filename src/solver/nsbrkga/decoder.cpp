@@ -1,11 +1,16 @@
 #include "solver/nsbrkga/decoder.hpp"
+#include "utils/profiler.hpp"
 #include <algorithm>
+#include <cmath>
 #include <limits>
 
 namespace mofjssp {
 
 Decoder::Decoder(const Instance & instance,
-                 unsigned num_threads)
+                 unsigned num_threads,
+                 const std::shared_ptr<Decode_Cache> & decode_cache,
+                 bool active,
+                 Key_Precision key_precision)
     : instance(instance),
       machine_of_operation_of_thread(num_threads,
                                      std::vector<std::vector<unsigned>>(
@@ -20,14 +25,48 @@ Decoder::Decoder(const Instance & instance,
       ending_time_of_operation_of_thread(num_threads,
                                            std::vector<std::vector<double>>(
                                                 instance.num_jobs)),
-      value_of_thread(num_threads,
-                      std::vector<double>(instance.num_objectives)),
+      value_of_thread(num_threads),
       permutation_of_thread(num_threads,
                             std::vector<std::pair<double, unsigned>>(
                                     instance.total_num_operations)),
       num_scheduled_operations_of_job_of_thread(num_threads,
                                                 std::vector<unsigned>(
-                                                        instance.num_jobs, 0)) {
+                                                        instance.num_jobs, 0)),
+      decode_cache(decode_cache),
+      job_of_gene(instance.total_num_operations),
+      operation_of_gene(instance.total_num_operations),
+      max_num_incremental_genes(std::ceil(std::log2(
+                      instance.total_num_operations + 1.0))),
+      last_chromosome_of_thread(num_threads),
+      num_valid_positions_of_thread(num_threads, 0),
+      operation_of_position_of_thread(
+            num_threads,
+            std::vector<std::tuple<unsigned, unsigned, unsigned>>(
+                    instance.total_num_operations)),
+      position_of_operation_of_thread(num_threads,
+                                      std::vector<std::vector<unsigned>>(
+                                            instance.num_jobs)),
+      processing_time_of_operation_of_thread(
+            num_threads,
+            std::vector<std::vector<double>>(instance.num_jobs)),
+      active(active),
+      gaps_of_machine_of_thread(num_threads,
+                                std::vector<Gap_Index>(
+                                        active ? instance.num_machines : 0)),
+      workload_of_machine_of_thread(num_threads,
+                                    std::vector<double>(
+                                            instance.num_machines, 0.0)),
+      key_precision(key_precision),
+      key_of_thread(num_threads) {
+    for (unsigned job = 0, i = 0; job < this->instance.num_jobs; job++) {
+        for (unsigned operation = 0;
+             operation < this->instance.num_operations[job];
+             operation++, i++) {
+            this->job_of_gene[i] = job;
+            this->operation_of_gene[i] = operation;
+        }
+    }
+
     for (unsigned thread = 0; thread < num_threads; thread++) {
         for (unsigned job = 0; job < this->instance.num_jobs; job++) {
             this->machine_of_operation_of_thread[thread][job].resize(
@@ -36,6 +75,10 @@ Decoder::Decoder(const Instance & instance,
                 this->instance.num_operations[job]);
             this->ending_time_of_operation_of_thread[thread][job].resize(
                 this->instance.num_operations[job]);
+            this->position_of_operation_of_thread[thread][job].resize(
+                this->instance.num_operations[job]);
+            this->processing_time_of_operation_of_thread[thread][job].resize(
+                this->instance.num_operations[job]);
         }
 
         for (unsigned machine = 0;
@@ -47,91 +90,281 @@ Decoder::Decoder(const Instance & instance,
     }
 }
 
+unsigned Decoder::machine_of_gene(unsigned gene, double allele) const {
+    const std::vector<unsigned> & machines =
+        this->instance.machines_of_operation[this->job_of_gene[gene]]
+                                            [this->operation_of_gene[gene]];
+
+    return machines[machine_index(allele, machines.size())];
+}
+
 std::vector<double> Decoder::decode(NSBRKGA::Chromosome & chromosome,
                                     bool /* not used */) {
+    const Objectives<> & value = this->evaluate(chromosome, ALL_OBJECTIVES);
+
+    return std::vector<double>(value.begin(), value.end());
+}
+
+const Objectives<> & Decoder::evaluate(const NSBRKGA::Chromosome & chromosome,
+                                       unsigned objectives) {
+    return this->evaluate(chromosome.data(), objectives);
+}
+
+void Decoder::decode(Population_Matrix & population) {
 #   ifdef _OPENMP
-        std::vector<std::vector<unsigned>> & machine_of_operation =
-            this->machine_of_operation_of_thread[omp_get_thread_num()];
-        std::vector<std::vector<std::pair<unsigned, unsigned>>> &
-            operations_of_machine =
-                this->operations_of_machine_of_thread[omp_get_thread_num()];
-        std::vector<std::vector<double>> & starting_time_of_operation =
-            this->starting_time_of_operation_of_thread[omp_get_thread_num()];
-        std::vector<std::vector<double>> & ending_time_of_operation = 
-            this->ending_time_of_operation_of_thread[omp_get_thread_num()];
-        std::vector<double> & value =
-            this->value_of_thread[omp_get_thread_num()];
-        std::vector<std::pair<double, unsigned>> & permutation = 
-            this->permutation_of_thread[omp_get_thread_num()];
-        std::vector<unsigned> & num_scheduled_operations_of_job =
-            this->num_scheduled_operations_of_job_of_thread[
-                omp_get_thread_num()];
+#       pragma omp parallel for num_threads(this->value_of_thread.size()) \
+            schedule(static)
+#   endif
+    for (std::size_t i = 0; i < population.size(); i++) {
+#       ifdef _OPENMP
+            const unsigned thread = omp_get_thread_num();
+#       else
+            const unsigned thread = 0;
+#       endif
+
+        std::vector<double> & key = this->key_of_thread[thread];
+
+        key.resize(population.key_size);
+        population.get_key(i, key.data());
+
+        const Objectives<> & value = this->evaluate(key.data(),
+                                                    ALL_OBJECTIVES);
+
+        std::copy(value.begin(),
+                  value.begin() + population.num_values,
+                  population.value(i).begin());
+    }
+}
+
+const Objectives<> & Decoder::evaluate(const double * chromosome,
+                                       unsigned objectives) {
+    MOFJSSP_PROFILE_SCOPE(DECODE);
+
+#   ifdef _OPENMP
+        const unsigned thread = omp_get_thread_num();
 #   else
-        std::vector<std::vector<unsigned>> & machine_of_operation =
-            this->machine_of_operation_of_thread.front();
-        std::vector<std::vector<std::pair<unsigned, unsigned>>> &
-            operations_of_machine =
-                this->operations_of_machine_of_thread.front();
-        std::vector<std::vector<double>> & starting_time_of_operation =
-            this->starting_time_of_operation_of_thread.front();
-        std::vector<std::vector<double>> & ending_time_of_operation =
-            this->ending_time_of_operation_of_thread.front();
-        std::vector<double> & value = this->value_of_thread.front();
-        std::vector<std::pair<double, unsigned>> & permutation =
-            this->permutation_of_thread.front();
-        std::vector<unsigned> & num_scheduled_operations_of_job =
-            this->num_scheduled_operations_of_job_of_thread.front();
+        const unsigned thread = 0;
 #   endif
 
-    for (unsigned machine = 0;
-        machine < this->instance.num_machines;
-        machine++) {
-        operations_of_machine[machine].clear();
-        operations_of_machine[machine].reserve(
-                this->instance.operations_of_machine[machine].size());
+    std::vector<std::vector<unsigned>> & machine_of_operation =
+        this->machine_of_operation_of_thread[thread];
+    std::vector<std::vector<std::pair<unsigned, unsigned>>> &
+        operations_of_machine = this->operations_of_machine_of_thread[thread];
+    std::vector<std::vector<double>> & starting_time_of_operation =
+        this->starting_time_of_operation_of_thread[thread];
+    std::vector<std::vector<double>> & ending_time_of_operation =
+        this->ending_time_of_operation_of_thread[thread];
+    Objectives<> & value = this->value_of_thread[thread];
+    std::vector<std::pair<double, unsigned>> & permutation =
+        this->permutation_of_thread[thread];
+    std::vector<unsigned> & num_scheduled_operations_of_job =
+        this->num_scheduled_operations_of_job_of_thread[thread];
+    NSBRKGA::Chromosome & last_chromosome =
+        this->last_chromosome_of_thread[thread];
+    unsigned & num_valid_positions =
+        this->num_valid_positions_of_thread[thread];
+    std::vector<std::tuple<unsigned, unsigned, unsigned>> &
+        operation_of_position = this->operation_of_position_of_thread[thread];
+    std::vector<std::vector<unsigned>> & position_of_operation =
+        this->position_of_operation_of_thread[thread];
+    std::vector<std::vector<double>> & processing_time_of_operation =
+        this->processing_time_of_operation_of_thread[thread];
+    std::vector<Gap_Index> & gaps_of_machine =
+        this->gaps_of_machine_of_thread[thread];
+    std::vector<double> & workload_of_machine =
+        this->workload_of_machine_of_thread[thread];
+    const unsigned total_num_operations = this->instance.total_num_operations;
+    const std::size_t chromosome_size = 2 * total_num_operations;
+
+    // The alleles are quantized as they are read, and the last chromosome
+    // holds the quantized alleles
+    const Key_Precision key_precision = this->key_precision;
+    const auto allele = [chromosome, key_precision](std::size_t gene) {
+        return quantize(chromosome[gene], key_precision);
+    };
+
+    // The schedule of the positions before the first position is reused
+    unsigned first_position = 0;
+    std::vector<unsigned> changed_genes;
+
+    if (last_chromosome.size() == chromosome_size) {
+        for (unsigned gene = 0;
+             gene < chromosome_size &&
+                changed_genes.size() <= this->max_num_incremental_genes;
+             gene++) {
+            if (allele(gene) != last_chromosome[gene]) {
+                changed_genes.push_back(gene);
+            }
+        }
     }
 
-    // Uses the first half of the chromosome to compute the machine that will 
-    // process each operation
-    for (unsigned job = 0, i = 0; job < this->instance.num_jobs; job++) {
-        for (unsigned operation = 0;
-             operation < this->instance.num_operations[job];
-             operation++, i++) {
-            const unsigned num_machines_of_operation =
-                    this->instance.machines_of_operation[job][operation].size();
-            const double delta = 1.0 / ((double) num_machines_of_operation);
-            auto machine_iterator =
-                this->instance.machines_of_operation[job][operation].begin();
-
-            for (double j = delta;
-                 j + std::numeric_limits<double>::epsilon() < chromosome[i];
-                 j += delta) {
-                machine_iterator++;
+    if (last_chromosome.size() == chromosome_size &&
+            changed_genes.size() <= this->max_num_incremental_genes) {
+        // Only the changed genes are decoded again, and the schedule is
+        // replayed from the first position they affect
+        first_position = num_valid_positions;
+
+        for (const unsigned & gene : changed_genes) {
+            if (gene < total_num_operations) {
+                const unsigned job = this->job_of_gene[gene],
+                               operation = this->operation_of_gene[gene],
+                               machine = this->machine_of_gene(
+                                       gene, allele(gene));
+
+                if (machine_of_operation[job][operation] != machine) {
+                    workload_of_machine[machine_of_operation[job][operation]] -=
+                        processing_time_of_operation[job][operation];
+
+                    machine_of_operation[job][operation] = machine;
+                    processing_time_of_operation[job][operation] =
+                        this->instance.processing_time.at(
+                                std::make_tuple(job, operation, machine));
+
+                    workload_of_machine[machine] +=
+                        processing_time_of_operation[job][operation];
+                    first_position = std::min(
+                            first_position,
+                            position_of_operation[job][operation]);
+                }
+            } else {
+                const unsigned job =
+                    this->job_of_gene[gene - total_num_operations];
+                auto it = std::lower_bound(
+                        permutation.begin(),
+                        permutation.end(),
+                        std::make_pair(last_chromosome[gene], job));
+
+                first_position = std::min(
+                        first_position,
+                        unsigned(it - permutation.begin()));
+                permutation.erase(it);
+
+                it = std::lower_bound(
+                        permutation.begin(),
+                        permutation.end(),
+                        std::make_pair(allele(gene), job));
+
+                first_position = std::min(
+                        first_position,
+                        unsigned(it - permutation.begin()));
+                permutation.insert(it, std::make_pair(allele(gene), job));
             }
 
-            machine_of_operation[job][operation] = *machine_iterator;
+            last_chromosome[gene] = allele(gene);
         }
-    }
+    } else {
+        // Uses the first half of the chromosome to compute the machine that
+        // will process each operation, and accumulates the workloads of the
+        // machines, which do not depend on the sequence
+        std::fill(workload_of_machine.begin(), workload_of_machine.end(), 0.0);
+        last_chromosome.resize(chromosome_size);
 
-    // Uses the second half of the chromosome to compute the order that each 
-    // operation will be processed
-    for (unsigned job = 0, i = 0; job < this->instance.num_jobs; job++) {
-        for (unsigned operation = 0;
-             operation < this->instance.num_operations[job];
-             operation++, i++) {
+        for (unsigned job = 0, i = 0; job < this->instance.num_jobs; job++) {
+            for (unsigned operation = 0;
+                 operation < this->instance.num_operations[job];
+                 operation++, i++) {
+                last_chromosome[i] = allele(i);
+
+                const unsigned machine = this->machine_of_gene(
+                        i, last_chromosome[i]);
+
+                machine_of_operation[job][operation] = machine;
+                processing_time_of_operation[job][operation] =
+                    this->instance.processing_time.at(
+                            std::make_tuple(job, operation, machine));
+                workload_of_machine[machine] +=
+                    processing_time_of_operation[job][operation];
+            }
+        }
+
+        // Uses the second half of the chromosome to compute the order that
+        // each operation will be processed
+        for (unsigned i = 0; i < total_num_operations; i++) {
+            last_chromosome[total_num_operations + i] =
+                allele(total_num_operations + i);
             permutation[i] = std::make_pair(
-                    chromosome[this->instance.total_num_operations + i], job);
+                    last_chromosome[total_num_operations + i],
+                    this->job_of_gene[i]);
+        }
+
+        std::sort(permutation.begin(), permutation.end());
+    }
+
+    // An operation inserted in an idle interval may be placed before
+    // operations of earlier positions, so active schedules are replayed
+    // from the first position
+    if (this->active) {
+        first_position = 0;
+
+        for (Gap_Index & gaps : gaps_of_machine) {
+            gaps.clear();
         }
     }
 
-    std::sort(permutation.begin(), permutation.end());
+    // Undoes the schedule of the positions to be replayed, from the last
+    while (num_valid_positions > first_position) {
+        const auto & [job, operation, machine] =
+            operation_of_position[--num_valid_positions];
+
+        operations_of_machine[machine].pop_back();
+        num_scheduled_operations_of_job[job]--;
+    }
+
+    // The schedule is fully determined at this point, so a cached value
+    // spares the timing simulation
+    Decode_Cache::Key key;
+
+    if (this->decode_cache) {
+        key = Decode_Cache::key(machine_of_operation, permutation);
 
-    num_scheduled_operations_of_job.assign(this->instance.num_jobs, 0);
+        if (this->decode_cache->find(key, value)) {
+            for (unsigned k = 0; k < value.size(); k++) {
+                if (!(objectives & (1u << k))) {
+                    value[k] = 0.0;
+                }
+            }
+
+            return value;
+        }
+    }
+
+    value.fill(0.0);
 
-    for (unsigned i = 0; i < permutation.size(); i++) {
+    // Computes the maximal machine workload
+    // and the total workload of the machines
+    if (objectives & (MAXIMAL_WORKLOAD | TOTAL_WORKLOAD)) {
+        double maximal_workload = 0.0,
+               total_workload = 0.0;
+
+        for (const double & workload : workload_of_machine) {
+            if (maximal_workload < workload) {
+                maximal_workload = workload;
+            }
+
+            total_workload += workload;
+        }
+
+        if (objectives & MAXIMAL_WORKLOAD) {
+            value[2] = maximal_workload;
+        }
+
+        if (objectives & TOTAL_WORKLOAD) {
+            value[3] = total_workload;
+        }
+    }
+
+    // The workloads are known from the machine assignment, so the schedule
+    // is only simulated for the makespan or the total completion time
+    if (!(objectives & (MAKESPAN | TOTAL_COMPLETION_TIME))) {
+        return value;
+    }
+
+    for (unsigned i = first_position; i < permutation.size(); i++) {
         const unsigned job = permutation[i].second,
                        operation = num_scheduled_operations_of_job[job],
                        machine = machine_of_operation[job][operation];
+        const double processing_time =
+            processing_time_of_operation[job][operation];
         double starting_time = 0.0,
                ending_time = 0.0;
 
@@ -139,7 +372,10 @@ std::vector<double> Decoder::decode(NSBRKGA::Chromosome & chromosome,
             starting_time = ending_time_of_operation[job][operation - 1];
         }
 
-        if (!operations_of_machine[machine].empty() && 
+        if (this->active) {
+            starting_time = gaps_of_machine[machine].insert(starting_time,
+                                                            processing_time);
+        } else if (!operations_of_machine[machine].empty() &&
             starting_time < ending_time_of_operation
                 [operations_of_machine[machine].back().first]
                 [operations_of_machine[machine].back().second]) {
@@ -148,49 +384,44 @@ std::vector<double> Decoder::decode(NSBRKGA::Chromosome & chromosome,
                             [operations_of_machine[machine].back().second];
         }
 
-        ending_time = starting_time + this->instance.processing_time.at(
-                std::make_tuple(job, operation, machine));
+        ending_time = starting_time + processing_time;
 
         operations_of_machine[machine].push_back(std::make_pair(job, operation));
-        
+
         starting_time_of_operation[job][operation] = starting_time;
         ending_time_of_operation[job][operation] = ending_time;
+        position_of_operation[job][operation] = i;
+        operation_of_position[i] = std::make_tuple(job, operation, machine);
 
         num_scheduled_operations_of_job[job]++;
     }
 
+    num_valid_positions = permutation.size();
+
     // Computes the makespan and the total completion time
-    value[0] = 0.0;
-    value[1] = 0.0;
+    double makespan = 0.0,
+           total_completion_time = 0.0;
 
     for (unsigned job = 0; job < this->instance.num_jobs; job++) {
-        if (value[0] < ending_time_of_operation[job].back()) {
-            value[0] = ending_time_of_operation[job].back();
+        if (makespan < ending_time_of_operation[job].back()) {
+            makespan = ending_time_of_operation[job].back();
         }
 
-        value[1] += ending_time_of_operation[job].back();
+        total_completion_time += ending_time_of_operation[job].back();
     }
 
-    // Computes the maximal machine workload
-    // and the total workload of the machines
-    value[2] = 0.0;
-    value[3] = 0.0;
-
-    for (unsigned machine = 0;
-         machine < this->instance.num_machines;
-         machine++) {
-        double workload = 0.0;
-
-        for (const auto & [job, operation] : operations_of_machine[machine]) {
-            workload += this->instance.processing_time.at(
-                    std::make_tuple(job, operation, machine));
-        }
+    if (objectives & MAKESPAN) {
+        value[0] = makespan;
+    }
 
-        if (value[2] < workload) {
-            value[2] = workload;
-        }
+    if (objectives & TOTAL_COMPLETION_TIME) {
+        value[1] = total_completion_time;
+    }
 
-        value[3] += workload;
+    // Only complete values are cached
+    if (this->decode_cache &&
+            (objectives & ALL_OBJECTIVES) == ALL_OBJECTIVES) {
+        this->decode_cache->insert(key, value);
     }
 
     return value;
@@ -2,6 +2,10 @@
 
 #include "chromosome.hpp"
 #include "instance/instance.hpp"
+#include "solution/gap_index.hpp"
+#include "solver/decode_cache.hpp"
+#include "solver/population_matrix.hpp"
+#include <tuple>
 
 namespace mofjssp {
 
@@ -21,15 +25,82 @@ class Decoder {
     std::vector<std::vector<std::vector<double>>>
         ending_time_of_operation_of_thread;
 
-    std::vector<std::vector<double>> value_of_thread;
+    std::vector<Objectives<>> value_of_thread;
 
     std::vector<std::vector<std::pair<double, unsigned>>> permutation_of_thread;
 
     std::vector<std::vector<unsigned>> num_scheduled_operations_of_job_of_thread;
 
-    Decoder(const Instance & instance, unsigned num_threads);
+    std::shared_ptr<Decode_Cache> decode_cache;
+
+    // The job and the operation of each gene of each half of a chromosome
+    std::vector<unsigned> job_of_gene;
+
+    std::vector<unsigned> operation_of_gene;
+
+    // The maximum number of genes in which a chromosome may differ from
+    // the previous one decoded by the same thread to be decoded
+    // incrementally (never if 0)
+    unsigned max_num_incremental_genes;
+
+    // The state of the last decode of each thread, from which the next
+    // decode of the thread is replayed
+    std::vector<NSBRKGA::Chromosome> last_chromosome_of_thread;
+
+    std::vector<unsigned> num_valid_positions_of_thread;
+
+    std::vector<std::vector<std::tuple<unsigned, unsigned, unsigned>>>
+        operation_of_position_of_thread;
+
+    std::vector<std::vector<std::vector<unsigned>>>
+        position_of_operation_of_thread;
+
+    std::vector<std::vector<std::vector<double>>>
+        processing_time_of_operation_of_thread;
+
+    // Whether the schedules are active, in which case each operation is
+    // inserted in the earliest idle interval of its machine where it fits,
+    // and the schedules are always replayed from the first position
+    bool active;
+
+    std::vector<std::vector<Gap_Index>> gaps_of_machine_of_thread;
+
+    // The workload of each machine of each thread, accumulated while the
+    // machines of the operations are assigned
+    std::vector<std::vector<double>> workload_of_machine_of_thread;
+
+    // The precision in which the alleles are decoded, so that a key
+    // stored in that precision decodes to the same schedule, and the key
+    // read from a population matrix of each thread
+    Key_Precision key_precision;
+
+    std::vector<std::vector<double>> key_of_thread;
+
+    Decoder(const Instance & instance,
+            unsigned num_threads,
+            const std::shared_ptr<Decode_Cache> & decode_cache = nullptr,
+            bool active = false,
+            Key_Precision key_precision = Key_Precision::DOUBLE);
+
+    unsigned machine_of_gene(unsigned gene, double allele) const;
 
     std::vector<double> decode(NSBRKGA::Chromosome & chromosome, bool rewrite);
+
+    // Decodes a chromosome computing only a set of objectives (a bitwise
+    // or of Objective), e.g., the ones weighted by a scalarization; the
+    // other values are 0, and the schedule is not simulated if only the
+    // workloads are requested
+    const Objectives<> & evaluate(const NSBRKGA::Chromosome & chromosome,
+                                  unsigned objectives);
+
+    // The same, for a chromosome of 2 * total_num_operations alleles
+    // stored elsewhere, such as a row of a population matrix
+    const Objectives<> & evaluate(const double * chromosome,
+                                  unsigned objectives);
+
+    // Decodes the key of every individual of a population, in place, one
+    // row after the other of each thread
+    void decode(Population_Matrix & population);
 };
 
 }
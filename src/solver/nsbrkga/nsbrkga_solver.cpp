@@ -5,20 +5,29 @@ namespace mofjssp {
 NSBRKGA_Solver::NSBRKGA_Solver(const Instance & instance)
     : Solver::Solver(instance) {}
 
+NSBRKGA_Solver::NSBRKGA_Solver(const std::shared_ptr<const Instance> & instance)
+    : Solver::Solver(instance) {}
+
 NSBRKGA_Solver::NSBRKGA_Solver() = default;
 
 void NSBRKGA_Solver::capture_snapshot(
         const NSBRKGA::NSBRKGA<Decoder> & algorithm) {
+    MOFJSSP_PROFILE_SCOPE(SNAPSHOT);
+
     double time_snapshot = this->elapsed_time();
 
     this->best_solutions_snapshots.emplace_back(std::make_tuple(
                 this->num_iterations,
                 time_snapshot,
-                std::vector<std::vector<double>>(
-                    this->best_individuals.size())));
-    for (std::size_t i = 0; i < this->best_individuals.size(); i++) {
-        std::get<2>(this->best_solutions_snapshots.back())[i] =
-            this->best_individuals[i].first;
+                Population_Matrix(this->instance->num_objectives)));
+
+    Population_Matrix & best_values =
+        std::get<2>(this->best_solutions_snapshots.back());
+
+    best_values.reserve(this->best_individuals.size());
+
+    for (const auto & individual : this->best_individuals) {
+        best_values.push_back(individual.first);
     }
 
     this->num_non_dominated.resize(this->num_populations);
@@ -44,14 +53,18 @@ void NSBRKGA_Solver::capture_snapshot(
     this->populations_snapshots.emplace_back(std::make_tuple(
                 this->num_iterations,
                 time_snapshot,
-                std::vector<std::vector<std::vector<double>>>()));
+                std::vector<Population_Matrix>(
+                    this->num_populations,
+                    Population_Matrix(this->instance->num_objectives))));
 
     for (unsigned i = 0; i < this->num_populations; i++) {
-        std::get<2>(this->populations_snapshots.back()).emplace_back();
+        Population_Matrix & values =
+            std::get<2>(this->populations_snapshots.back())[i];
+
+        values.reserve(this->population_size);
 
         for (unsigned j = 0; j < this->population_size; j++) {
-            std::get<2>(this->populations_snapshots.back()).back().push_back(
-                    algorithm.getCurrentPopulation(i).getFitness(j));
+            values.push_back(algorithm.getCurrentPopulation(i).getFitness(j));
         }
     }
 
@@ -66,8 +79,13 @@ void NSBRKGA_Solver::capture_snapshot(
 
 void NSBRKGA_Solver::solve() {
     this->start_time = std::chrono::steady_clock::now();
+    this->reset_decode_cache();
 
-    Decoder decoder(this->instance, this->num_threads);
+    Decoder decoder(*this->instance,
+                    this->num_threads,
+                    this->decode_cache,
+                    this->active_schedule,
+                    this->key_precision);
 
     NSBRKGA::NsbrkgaParams params;
     params.num_incumbent_solutions = this->max_num_solutions;
@@ -85,9 +103,9 @@ void NSBRKGA_Solver::solve() {
     params.pr_percentage = this->pr_percentage;
 
     NSBRKGA::NSBRKGA algorithm(decoder,
-                               this->instance.senses,
+                               this->instance->senses,
                                this->seed,
-                               2 * this->instance.total_num_operations,
+                               2 * this->instance->total_num_operations,
                                params,
                                this->num_threads);
 
@@ -95,9 +113,14 @@ void NSBRKGA_Solver::solve() {
             this->num_populations);
 
     if (!this->initial_individuals.empty()) {
+        // The values of the initial individuals are decoded row after
+        // row of the matrix, by the threads of the decoder
+        decoder.decode(this->initial_individuals);
+        this->update_best_individuals(this->initial_individuals.individuals());
+
         for (std::size_t i = 0; i < this->initial_individuals.size(); i++) {
             initial_populations[i % this->num_populations].push_back(
-                    this->initial_individuals[i].second);
+                    this->initial_individuals.key(i));
         }
 
         algorithm.setInitialPopulations(initial_populations);
@@ -135,7 +158,14 @@ void NSBRKGA_Solver::solve() {
     while (!this->are_termination_criteria_met()) {
         this->num_iterations++;
 
-        if (algorithm.evolve()) {
+        bool improved;
+
+        {
+            MOFJSSP_PROFILE_SCOPE(EVOLVE);
+            improved = algorithm.evolve();
+        }
+
+        if (improved) {
             this->last_update_time = this->elapsed_time();
 
             auto update_offset = this->num_iterations -
@@ -149,6 +179,11 @@ void NSBRKGA_Solver::solve() {
             this->update_best_individuals(algorithm.getIncumbentSolutions());
         }
 
+        if (this->local_search_interval > 0 &&
+                this->num_iterations % this->local_search_interval == 0) {
+            this->improve_best_individuals(this->local_search_sample_size);
+        }
+
         if(this->max_num_snapshots > this->num_snapshots + 1) {
             if (this->num_iterations >= this->iteration_next_snapshot) {
                 this->capture_snapshot(algorithm);
@@ -186,11 +221,13 @@ void NSBRKGA_Solver::solve() {
 
         if (this->exchange_interval > 0 && this->num_iterations > 0 &&
                 (this->num_iterations % this->exchange_interval == 0)) {
+            MOFJSSP_PROFILE_SCOPE(EXCHANGE_ELITE);
             algorithm.exchangeElite(this->num_exchange_individuals);
         }
 
         if (this->pr_interval > 0 && this->num_iterations > 0 &&
                 (this->num_iterations % this->pr_interval == 0)) {
+            MOFJSSP_PROFILE_SCOPE(PATH_RELINK);
             this->num_path_relink_calls++;
             const auto pr_start_time = std::chrono::steady_clock::now();
             double pr_time_limit = this->time_limit;
@@ -240,12 +277,14 @@ void NSBRKGA_Solver::solve() {
 
         if (this->shake_interval > 0 && generations_without_improvement > 0 &&
                 (generations_without_improvement % this->shake_interval == 0)) {
+            MOFJSSP_PROFILE_SCOPE(SHAKE);
             this->num_shakings++;
             algorithm.shake(this->shake_intensity, this->shake_distribution);
         }
 
         if (this->reset_interval > 0 && generations_without_improvement > 0 &&
                 (generations_without_improvement % this->reset_interval) == 0) {
+            MOFJSSP_PROFILE_SCOPE(RESET);
             this->num_resets++;
             algorithm.reset(this->reset_intensity);
         }
@@ -255,13 +294,12 @@ void NSBRKGA_Solver::solve() {
         this->capture_snapshot(algorithm);
     }
 
-    this->best_solutions.clear();
-
-    for (const auto & best_individual : this->best_individuals) {
-        this->best_solutions.push_back(Solution(this->instance,
-                                                best_individual.second));
+    if (this->local_search) {
+        this->improve_best_individuals();
     }
 
+    this->materialize_best_solutions();
+
     this->solving_time = this->elapsed_time();
 }
 std::ostream & operator <<(std::ostream & os, const NSBRKGA_Solver & solver) {
@@ -207,6 +207,13 @@ class NSBRKGA_Solver : public Solver {
      *********************************************/
     NSBRKGA_Solver(const Instance & instance);
 
+    /*********************************************
+     * Constructs a new solver.
+     *
+     * @param instance the instance to be solved.
+     *********************************************/
+    NSBRKGA_Solver(const std::shared_ptr<const Instance> & instance);
+
     /******************************
      * Constructs an empty solver.
      ******************************/
@@ -1,5 +1,5 @@
 #include "solver/nsga2/nsga2_solver.hpp"
-#include "solver/nsga2/problem.hpp"
+#include "solver/problem.hpp"
 #include <pagmo/algorithms/nsga2.hpp>
 
 namespace mofjssp {
@@ -7,12 +7,19 @@ namespace mofjssp {
 NSGA2_Solver::NSGA2_Solver(const Instance & instance)
     : Solver::Solver(instance) {}
 
+NSGA2_Solver::NSGA2_Solver(const std::shared_ptr<const Instance> & instance)
+    : Solver::Solver(instance) {}
+
 NSGA2_Solver::NSGA2_Solver() = default;
 
 void NSGA2_Solver::solve() {
     this->start_time = std::chrono::steady_clock::now();
+    this->reset_decode_cache();
 
-    pagmo::problem prob{Problem(this->instance)};
+    pagmo::problem prob{Problem(this->instance,
+                                this->decode_cache,
+                                this->active_schedule,
+                                this->key_precision)};
 
     pagmo::algorithm algo{pagmo::nsga2(1,
                                        this->crossover_probability,
@@ -26,8 +33,9 @@ void NSGA2_Solver::solve() {
         this->population_size - this->initial_individuals.size(),
         this->seed};
 
-    for(const auto & individual : this->initial_individuals) {
-        pop.push_back(individual.second, individual.first);
+    for(std::size_t i = 0; i < this->initial_individuals.size(); i++) {
+        pop.push_back(this->initial_individuals.key(i),
+                      this->initial_individuals.value(i).vector());
     }
 
     this->update_best_individuals(pop);
@@ -59,9 +67,19 @@ void NSGA2_Solver::solve() {
 
     while(!this->are_termination_criteria_met()) {
         this->num_iterations++;
-        pop = algo.evolve(pop);
+
+        {
+            MOFJSSP_PROFILE_SCOPE(EVOLVE);
+            pop = algo.evolve(pop);
+        }
+
         this->update_best_individuals(pop);
 
+        if (this->local_search_interval > 0 &&
+                this->num_iterations % this->local_search_interval == 0) {
+            this->improve_best_individuals(pop);
+        }
+
         if(this->max_num_snapshots > this->num_snapshots + 1) {
             if (this->num_iterations >= this->iteration_next_snapshot) {
                 this->capture_snapshot(pop);
@@ -95,13 +113,12 @@ void NSGA2_Solver::solve() {
         this->capture_snapshot(pop);
     }
 
-    this->best_solutions.clear();
-
-    for(const auto & best_individual : this->best_individuals) {
-        this->best_solutions.push_back(Solution(this->instance,
-                                                best_individual.second));
+    if (this->local_search) {
+        this->improve_best_individuals();
     }
 
+    this->materialize_best_solutions();
+
     this->solving_time = this->elapsed_time();
 }
 
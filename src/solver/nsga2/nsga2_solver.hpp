@@ -42,6 +42,13 @@ class NSGA2_Solver : public Solver {
      *********************************************/
     NSGA2_Solver(const Instance & instance);
 
+    /*********************************************
+     * Constructs a new solver.
+     *
+     * @param instance the instance to be solved.
+     *********************************************/
+    NSGA2_Solver(const std::shared_ptr<const Instance> & instance);
+
     /*********************************
      * Constructs a new empty solver.
      *********************************/
@@ -68,6 +68,13 @@ class NSPSO_Solver : public Solver {
      *********************************************/
     NSPSO_Solver(const Instance & instance);
 
+    /*********************************************
+     * Constructs a new solver.
+     *
+     * @param instance the instance to be solved.
+     *********************************************/
+    NSPSO_Solver(const std::shared_ptr<const Instance> & instance);
+
     /*********************************
      * Constructs a new empty solver.
      *********************************/
@@ -0,0 +1,116 @@
+#include "solver/objective_space.hpp"
+#include <algorithm>
+#include <functional>
+#include <sstream>
+
+namespace mofjssp {
+
+Objective_Space::Objective_Space(
+        const std::vector<NSBRKGA::Sense> & senses,
+        const std::vector<double> & reference_point,
+        const std::vector<std::vector<double>> & reference_front)
+    : senses(senses),
+      reference_point(reference_point),
+      minimization_reference_point(Indicators::minimization_points(
+                  senses, {reference_point}, false)),
+      reference_points(Indicators::minimization_points(
+                  senses, reference_front, false)),
+      reference_hypervolume(this->hypervolume(this->front(reference_front))),
+      reference_igd_plus(
+              Indicators::sorted_modified_inverted_generational_distance(
+                  senses,
+                  this->reference_points,
+                  this->minimization_reference_point)) {}
+
+std::vector<double> Objective_Space::bounding_reference_point(
+        const std::vector<NSBRKGA::Sense> & senses,
+        const std::vector<double> & reference_point,
+        const std::vector<std::vector<double>> & front,
+        double offset) {
+    std::vector<double> bounding_point(reference_point);
+
+    for (const std::vector<double> & value : front) {
+        for (unsigned k = 0; k < senses.size(); k++) {
+            if (senses[k] == NSBRKGA::Sense::MINIMIZE) {
+                if (value[k] >= bounding_point[k]) {
+                    bounding_point[k] = value[k] + offset;
+                }
+            } else if (value[k] <= bounding_point[k]) {
+                bounding_point[k] = value[k] - offset;
+            }
+        }
+    }
+
+    return bounding_point;
+}
+
+Objective_Space::Front Objective_Space::front(
+        const std::vector<std::vector<double>> & values) const {
+    return Front{Indicators::minimization_points(this->senses, values, true)};
+}
+
+Objective_Space::Front Objective_Space::read_front(std::istream & is) const {
+    std::vector<std::vector<double>> values;
+
+    for (std::string line; std::getline(is, line);) {
+        std::istringstream iss(line);
+        std::vector<double> value(this->senses.size(), 0.0);
+
+        for (unsigned k = 0; k < this->senses.size(); k++) {
+            iss >> value[k];
+        }
+
+        values.push_back(value);
+    }
+
+    return this->front(values);
+}
+
+double Objective_Space::hypervolume(const Front & front) const {
+    const unsigned num_objectives = this->senses.size();
+    std::vector<std::vector<double>> points;
+
+    points.reserve(front.points.size() / num_objectives);
+
+    // The points not below the reference point in every objective, which
+    // a reference point tighter than the primal bound may leave, bound
+    // no volume
+    for (std::size_t j = 0; j < front.points.size(); j += num_objectives) {
+        if (std::equal(front.points.begin() + j,
+                       front.points.begin() + j + num_objectives,
+                       this->minimization_reference_point.begin(),
+                       std::less<double>())) {
+            points.emplace_back(front.points.begin() + j,
+                                front.points.begin() + j + num_objectives);
+        }
+    }
+
+    if (points.empty()) {
+        return 0.0;
+    }
+
+    return Indicators::hypervolume(
+            std::vector<NSBRKGA::Sense>(num_objectives,
+                                        NSBRKGA::Sense::MINIMIZE),
+            this->minimization_reference_point,
+            points);
+}
+
+double Objective_Space::hypervolume_ratio(const Front & front) const {
+    return this->hypervolume(front) / this->reference_hypervolume;
+}
+
+double Objective_Space::normalized_modified_inverted_generational_distance(
+        const Front & front) const {
+    return Indicators::sorted_modified_inverted_generational_distance(
+            this->senses, this->reference_points, front.points) /
+        this->reference_igd_plus;
+}
+
+double Objective_Space::multiplicative_epsilon(const Front & front) const {
+    return Indicators::sorted_multiplicative_epsilon(this->senses,
+                                                     this->reference_points,
+                                                     front.points);
+}
+
+}
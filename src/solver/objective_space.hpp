@@ -0,0 +1,148 @@
+#pragma once
+
+#include "solver/indicators.hpp"
+#include <istream>
+#include <vector>
+
+namespace mofjssp {
+/*********************************************************************
+ * The Objective_Space class holds the reference point and the
+ * reference front of an instance, with which the fronts found are
+ * compared. The reference front is converted once to minimization
+ * points, and its hypervolume and IGD+ with respect to the reference
+ * point, by which the indicators are normalized, are computed once, so
+ * that every front and snapshot of the instance reuses them.
+ *********************************************************************/
+class Objective_Space {
+    public:
+    /***************************
+     * The optimization senses.
+     ***************************/
+    const std::vector<NSBRKGA::Sense> senses;
+
+    /*******************************************
+     * The reference point of the hypervolume.
+     *******************************************/
+    const std::vector<double> reference_point;
+
+    /*****************************************************************
+     * A front, as its minimization points (with the maximization
+     * objectives negated) stored row after row and sorted by their
+     * first objective.
+     *****************************************************************/
+    struct Front {
+        std::vector<double> points;
+    };
+
+    private:
+    /*****************************************************************
+     * The reference point and the points of the reference front, in
+     * its order, with the maximization objectives negated.
+     *****************************************************************/
+    std::vector<double> minimization_reference_point;
+
+    std::vector<double> reference_points;
+
+    public:
+    /*****************************************************************
+     * The hypervolume of the reference front, and its IGD+ with
+     * respect to the reference point.
+     *****************************************************************/
+    const double reference_hypervolume;
+
+    const double reference_igd_plus;
+
+    /*****************************************************************
+     * Constructs a new objective space.
+     *
+     * @param senses          the optimization senses.
+     * @param reference_point the reference point.
+     * @param reference_front the reference front.
+     *****************************************************************/
+    Objective_Space(const std::vector<NSBRKGA::Sense> & senses,
+                    const std::vector<double> & reference_point,
+                    const std::vector<std::vector<double>> & reference_front);
+
+    /*****************************************************************
+     * Widens a reference point past the nadir point of a front, so
+     * that every point of the front is strictly inside the box it
+     * bounds, and so bounds some volume. In each objective where some
+     * point is not strictly better than the reference point, the
+     * reference point is moved to an offset past the worst value of
+     * the front. A reference point that already bounds the front, such
+     * as the primal bound, is kept.
+     *
+     * @param senses          the optimization senses.
+     * @param reference_point the reference point.
+     * @param front           the front.
+     * @param offset          the offset past the nadir point, one unit
+     *                        by default as the objective values of
+     *                        integral processing times are integral.
+     *
+     * @return the widened reference point.
+     *****************************************************************/
+    static std::vector<double> bounding_reference_point(
+            const std::vector<NSBRKGA::Sense> & senses,
+            const std::vector<double> & reference_point,
+            const std::vector<std::vector<double>> & front,
+            double offset = 1.0);
+
+    /*********************************************
+     * Converts the values of a front.
+     *
+     * @param values the objective values.
+     *
+     * @return the front.
+     *********************************************/
+    Front front(const std::vector<std::vector<double>> & values) const;
+
+    /*****************************************************************
+     * Reads a front, one point per line with its objective values.
+     *
+     * @param is the input stream.
+     *
+     * @return the front.
+     *****************************************************************/
+    Front read_front(std::istream & is) const;
+
+    /*******************************************
+     * Computes the hypervolume of a front.
+     *
+     * @param front the front.
+     *
+     * @return the hypervolume of the front.
+     *******************************************/
+    double hypervolume(const Front & front) const;
+
+    /*****************************************************************
+     * Computes the ratio of the hypervolume of a front to that of the
+     * reference front.
+     *
+     * @param front the front.
+     *
+     * @return the hypervolume ratio of the front.
+     *****************************************************************/
+    double hypervolume_ratio(const Front & front) const;
+
+    /*****************************************************************
+     * Computes the IGD+ of a front, divided by that of the reference
+     * point.
+     *
+     * @param front the front.
+     *
+     * @return the normalized IGD+ of the front.
+     *****************************************************************/
+    double normalized_modified_inverted_generational_distance(
+            const Front & front) const;
+
+    /*****************************************************************
+     * Computes the multiplicative epsilon indicator of a front.
+     *
+     * @param front the front.
+     *
+     * @return the multiplicative epsilon of the front.
+     *****************************************************************/
+    double multiplicative_epsilon(const Front & front) const;
+};
+
+}
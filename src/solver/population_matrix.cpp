@@ -0,0 +1,256 @@
+#include "solver/population_matrix.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace mofjssp {
+
+// Rounds a number of bytes up to a multiple of the alignment
+static std::size_t aligned_size(std::size_t size) {
+    return (size + Population_Matrix::alignment - 1) /
+           Population_Matrix::alignment * Population_Matrix::alignment;
+}
+
+void Population_Matrix::Deleter::operator()(unsigned char * arena) const {
+    std::free(arena);
+}
+
+Population_Matrix::Population_Matrix(std::size_t num_values,
+                                     std::size_t key_size,
+                                     Key_Precision key_precision)
+    : num_values(num_values),
+      key_size(key_size),
+      key_precision(key_precision),
+      values_stride(aligned_size(num_values * sizeof(double))),
+      stride(aligned_size(num_values * sizeof(double)) +
+             aligned_size(key_size * size_of_allele(key_precision))) {}
+
+Population_Matrix::Population_Matrix(const Population_Matrix & matrix)
+    : num_values(matrix.num_values),
+      key_size(matrix.key_size),
+      key_precision(matrix.key_precision),
+      values_stride(matrix.values_stride),
+      stride(matrix.stride) {
+    this->reserve(matrix.num_rows);
+
+    if (matrix.num_rows > 0) {
+        std::memcpy(this->arena.get(),
+                    matrix.arena.get(),
+                    matrix.num_rows * this->stride);
+    }
+
+    this->num_rows = matrix.num_rows;
+}
+
+Population_Matrix::Population_Matrix(Population_Matrix && matrix)
+    : num_values(matrix.num_values),
+      key_size(matrix.key_size),
+      key_precision(matrix.key_precision),
+      values_stride(matrix.values_stride),
+      stride(matrix.stride),
+      num_rows(matrix.num_rows),
+      capacity(matrix.capacity),
+      arena(std::move(matrix.arena)) {
+    // The moved matrix has no rows, so that it reallocates before
+    // writing any
+    matrix.num_rows = 0;
+    matrix.capacity = 0;
+}
+
+Population_Matrix & Population_Matrix::operator = (
+        const Population_Matrix & matrix) {
+    if (this != &matrix) {
+        Population_Matrix copy(matrix);
+
+        *this = std::move(copy);
+    }
+
+    return *this;
+}
+
+Population_Matrix & Population_Matrix::operator = (
+        Population_Matrix && matrix) {
+    if (this != &matrix) {
+        this->num_values = matrix.num_values;
+        this->key_size = matrix.key_size;
+        this->key_precision = matrix.key_precision;
+        this->values_stride = matrix.values_stride;
+        this->stride = matrix.stride;
+        this->num_rows = matrix.num_rows;
+        this->capacity = matrix.capacity;
+        this->arena = std::move(matrix.arena);
+
+        matrix.num_rows = 0;
+        matrix.capacity = 0;
+    }
+
+    return *this;
+}
+
+unsigned char * Population_Matrix::row(std::size_t i) const {
+    return this->arena.get() + i * this->stride;
+}
+
+std::size_t Population_Matrix::size() const {
+    return this->num_rows;
+}
+
+bool Population_Matrix::empty() const {
+    return this->num_rows == 0;
+}
+
+void Population_Matrix::reserve(std::size_t capacity) {
+    if (capacity <= this->capacity || this->stride == 0) {
+        return;
+    }
+
+    unsigned char * arena = static_cast<unsigned char *>(std::aligned_alloc(
+                Population_Matrix::alignment,
+                capacity * this->stride));
+
+    if (arena == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    if (this->num_rows > 0) {
+        std::memcpy(arena,
+                    this->arena.get(),
+                    this->num_rows * this->stride);
+    }
+
+    this->arena.reset(arena);
+    this->capacity = capacity;
+}
+
+void Population_Matrix::resize(std::size_t size) {
+    if (size > this->capacity) {
+        this->reserve(std::max(size, 2 * this->capacity));
+    }
+
+    if (size > this->num_rows) {
+        std::fill(this->row(this->num_rows), this->row(size), 0);
+    }
+
+    this->num_rows = size;
+}
+
+void Population_Matrix::clear() {
+    this->num_rows = 0;
+}
+
+void Population_Matrix::push_back(const double * value, const double * key) {
+    this->resize(this->num_rows + 1);
+
+    const std::size_t i = this->num_rows - 1;
+
+    std::copy(value, value + this->num_values, this->value(i).begin());
+
+    if (key != nullptr) {
+        this->set_key(i, key);
+    }
+}
+
+void Population_Matrix::push_back(const std::vector<double> & value,
+                                  const std::vector<double> & key) {
+    this->push_back(value.data(), key.empty() ? nullptr : key.data());
+}
+
+Row_View<double> Population_Matrix::value(std::size_t i) {
+    return Row_View<double>(reinterpret_cast<double *>(this->row(i)),
+                            this->num_values);
+}
+
+Row_View<const double> Population_Matrix::value(std::size_t i) const {
+    return Row_View<const double>(
+            reinterpret_cast<const double *>(this->row(i)),
+            this->num_values);
+}
+
+void Population_Matrix::get_key(std::size_t i, double * key) const {
+    const unsigned char * alleles = this->row(i) + this->values_stride;
+
+    switch (this->key_precision) {
+        case Key_Precision::FLOAT: {
+            const float * first = reinterpret_cast<const float *>(alleles);
+
+            std::copy(first, first + this->key_size, key);
+            break;
+        }
+        case Key_Precision::FIXED16: {
+            const std::uint16_t * first =
+                reinterpret_cast<const std::uint16_t *>(alleles);
+
+            for (std::size_t j = 0; j < this->key_size; j++) {
+                key[j] = double(first[j]) / max_fixed16_allele;
+            }
+
+            break;
+        }
+        default: {
+            const double * first = reinterpret_cast<const double *>(alleles);
+
+            std::copy(first, first + this->key_size, key);
+        }
+    }
+}
+
+std::vector<double> Population_Matrix::key(std::size_t i) const {
+    std::vector<double> key(this->key_size);
+
+    this->get_key(i, key.data());
+
+    return key;
+}
+
+void Population_Matrix::set_key(std::size_t i, const double * key) {
+    unsigned char * alleles = this->row(i) + this->values_stride;
+
+    switch (this->key_precision) {
+        case Key_Precision::FLOAT:
+            std::copy(key, key + this->key_size,
+                      reinterpret_cast<float *>(alleles));
+            break;
+        case Key_Precision::FIXED16: {
+            std::uint16_t * first = reinterpret_cast<std::uint16_t *>(alleles);
+
+            for (std::size_t j = 0; j < this->key_size; j++) {
+                first[j] = to_fixed16(key[j]);
+            }
+
+            break;
+        }
+        default:
+            std::copy(key, key + this->key_size,
+                      reinterpret_cast<double *>(alleles));
+    }
+}
+
+Row_View<const double> Population_Matrix::operator [](std::size_t i) const {
+    return this->value(i);
+}
+
+std::vector<std::pair<std::vector<double>, std::vector<double>>>
+        Population_Matrix::individuals() const {
+    std::vector<std::pair<std::vector<double>, std::vector<double>>>
+        individuals;
+
+    individuals.reserve(this->num_rows);
+
+    for (std::size_t i = 0; i < this->num_rows; i++) {
+        individuals.push_back(std::make_pair(this->value(i).vector(),
+                                             this->key(i)));
+    }
+
+    return individuals;
+}
+
+Population_Matrix::Iterator Population_Matrix::begin() const {
+    return Iterator{this, 0};
+}
+
+Population_Matrix::Iterator Population_Matrix::end() const {
+    return Iterator{this, this->num_rows};
+}
+
+}
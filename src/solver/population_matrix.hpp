@@ -0,0 +1,292 @@
+#pragma once
+
+#include "solution/key_precision.hpp"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace mofjssp {
+/*********************************************************************
+ * A view of a row of a population matrix, i.e., of the contiguous
+ * values or key of an individual.
+ *********************************************************************/
+template <class T>
+class Row_View {
+    public:
+    /**************************************
+     * The first element of the row.
+     **************************************/
+    T * first;
+
+    /**************************************
+     * The number of elements of the row.
+     **************************************/
+    std::size_t length;
+
+    Row_View(T * first, std::size_t length)
+        : first(first), length(length) {}
+
+    std::size_t size() const {
+        return this->length;
+    }
+
+    bool empty() const {
+        return this->length == 0;
+    }
+
+    T * data() const {
+        return this->first;
+    }
+
+    T * begin() const {
+        return this->first;
+    }
+
+    T * end() const {
+        return this->first + this->length;
+    }
+
+    T & operator [](std::size_t i) const {
+        return this->first[i];
+    }
+
+    T & front() const {
+        return this->first[0];
+    }
+
+    T & back() const {
+        return this->first[this->length - 1];
+    }
+
+    /**************************************
+     * Returns a copy of the row.
+     *
+     * @return the elements of the row.
+     **************************************/
+    std::vector<double> vector() const {
+        return std::vector<double>(this->begin(), this->end());
+    }
+};
+
+/*********************************************************************
+ * The Population_Matrix class stores the objective values and the
+ * keys of a population in a single arena, one row per individual,
+ * so that adding individuals does not allocate each of them
+ * separately and a whole population is streamed through the cache.
+ * Every row, and the key within it, starts at a 64-byte boundary.
+ * The keys may be stored in a lower precision, and are converted
+ * from and to doubles when read and written. The matrices hold the
+ * initial individuals and the snapshots of the solvers, while the
+ * best individuals and the archive keep (value, key) fronts.
+ *********************************************************************/
+class Population_Matrix {
+    public:
+    /*********************************************
+     * The number of objective values of a row.
+     *********************************************/
+    std::size_t num_values;
+
+    /*********************************************
+     * The number of alleles of the key of a row.
+     *********************************************/
+    std::size_t key_size;
+
+    /*********************************************
+     * The precision in which the keys are stored.
+     *********************************************/
+    Key_Precision key_precision;
+
+    /*************************************
+     * The alignment of the rows in bytes.
+     *************************************/
+    static constexpr std::size_t alignment = 64;
+
+    private:
+    /*******************************************
+     * Releases the memory of an arena.
+     *******************************************/
+    struct Deleter {
+        void operator()(unsigned char * arena) const;
+    };
+
+    /*******************************************************
+     * The number of bytes of the values and of a row,
+     * rounded up to a multiple of the alignment.
+     *******************************************************/
+    std::size_t values_stride;
+
+    std::size_t stride;
+
+    /***************************************
+     * The number of rows in use and
+     * allocated.
+     ***************************************/
+    std::size_t num_rows = 0;
+
+    std::size_t capacity = 0;
+
+    /**********************
+     * The rows.
+     **********************/
+    std::unique_ptr<unsigned char[], Deleter> arena;
+
+    /***************************************
+     * Returns the first byte of a row.
+     ***************************************/
+    unsigned char * row(std::size_t i) const;
+
+    public:
+    /*************************************************************
+     * Constructs a new empty population matrix.
+     *
+     * @param num_values    the number of objective values.
+     * @param key_size      the number of alleles of the keys.
+     * @param key_precision the precision of the stored keys.
+     *************************************************************/
+    Population_Matrix(std::size_t num_values = 0,
+                      std::size_t key_size = 0,
+                      Key_Precision key_precision = Key_Precision::DOUBLE);
+
+    /*****************************************
+     * Copy constructor.
+     *
+     * @param matrix the matrix been copied.
+     *****************************************/
+    Population_Matrix(const Population_Matrix & matrix);
+
+    /*****************************************************
+     * Move constructor, leaving the moved matrix empty.
+     *
+     * @param matrix the matrix been moved.
+     *****************************************************/
+    Population_Matrix(Population_Matrix && matrix);
+
+    Population_Matrix & operator = (const Population_Matrix & matrix);
+
+    Population_Matrix & operator = (Population_Matrix && matrix);
+
+    /***************************************
+     * Returns the number of individuals.
+     *
+     * @return the number of individuals.
+     ***************************************/
+    std::size_t size() const;
+
+    bool empty() const;
+
+    /*****************************************************
+     * Allocates the rows of a number of individuals.
+     *
+     * @param capacity the number of individuals.
+     *****************************************************/
+    void reserve(std::size_t capacity);
+
+    /*****************************************************
+     * Resizes the matrix, with new rows filled with 0.
+     *
+     * @param size the number of individuals.
+     *****************************************************/
+    void resize(std::size_t size);
+
+    /******************************************
+     * Removes every individual, keeping the
+     * allocated rows.
+     ******************************************/
+    void clear();
+
+    /*********************************************************
+     * Appends an individual; a missing key is filled with 0.
+     *
+     * @param value the objective values of the individual.
+     * @param key   the key of the individual.
+     *********************************************************/
+    void push_back(const double * value, const double * key = nullptr);
+
+    void push_back(const std::vector<double> & value,
+                   const std::vector<double> & key = {});
+
+    /***************************************************
+     * Returns the objective values of an individual.
+     *
+     * @param i the index of the individual.
+     *
+     * @return the objective values of the individual.
+     ***************************************************/
+    Row_View<double> value(std::size_t i);
+
+    Row_View<const double> value(std::size_t i) const;
+
+    /***************************************
+     * Reads the key of an individual.
+     *
+     * @param i   the index of the individual.
+     * @param key the alleles of the key.
+     ***************************************/
+    void get_key(std::size_t i, double * key) const;
+
+    /***************************************
+     * Returns the key of an individual.
+     *
+     * @param i the index of the individual.
+     *
+     * @return the key of the individual.
+     ***************************************/
+    std::vector<double> key(std::size_t i) const;
+
+    /************************************************************
+     * Writes the key of an individual, quantized to the precision
+     * of the matrix.
+     *
+     * @param i   the index of the individual.
+     * @param key the alleles of the key.
+     ************************************************************/
+    void set_key(std::size_t i, const double * key);
+
+    /**************************************************
+     * Returns the objective values of an individual,
+     * as the rows of a matrix of objective values.
+     *
+     * @param i the index of the individual.
+     *
+     * @return the objective values of the individual.
+     **************************************************/
+    Row_View<const double> operator [](std::size_t i) const;
+
+    /*********************************************************
+     * Returns the (value, key) pairs of the individuals.
+     *
+     * @return the (value, key) pairs of the individuals.
+     *********************************************************/
+    std::vector<std::pair<std::vector<double>, std::vector<double>>>
+        individuals() const;
+
+    /*****************************************
+     * Iterates over the objective values of
+     * the individuals.
+     *****************************************/
+    class Iterator {
+        public:
+        const Population_Matrix * matrix;
+
+        std::size_t i;
+
+        Row_View<const double> operator *() const {
+            return (*this->matrix)[this->i];
+        }
+
+        Iterator & operator ++() {
+            this->i++;
+            return *this;
+        }
+
+        bool operator != (const Iterator & iterator) const {
+            return this->i != iterator.i;
+        }
+    };
+
+    Iterator begin() const;
+
+    Iterator end() const;
+};
+
+}
@@ -0,0 +1,61 @@
+#include "solver/problem.hpp"
+#include "solution/solution.hpp"
+#include "utils/profiler.hpp"
+
+namespace mofjssp {
+
+Problem::Problem(const std::shared_ptr<const Instance> & instance,
+                 const std::shared_ptr<Decode_Cache> & decode_cache,
+                 bool active,
+                 Key_Precision key_precision)
+    : instance(instance),
+      decode_cache(decode_cache),
+      active(active),
+      key_precision(key_precision) {}
+
+Problem::Problem() {}
+
+pagmo::vector_double Problem::fitness(const pagmo::vector_double & dv) const {
+    MOFJSSP_PROFILE_SCOPE(DECODE);
+
+    Solution solution(*this->instance);
+    std::vector<std::pair<double, unsigned>> permutation;
+    Decode_Cache::Key key;
+
+    Solution::decode(*this->instance,
+                     dv,
+                     solution.machine_of_operation,
+                     permutation,
+                     this->key_precision);
+
+    if (this->decode_cache) {
+        Objectives<> value;
+
+        key = Decode_Cache::key(solution.machine_of_operation, permutation);
+
+        if (this->decode_cache->find(key, value)) {
+            return pagmo::vector_double(value.begin(), value.end());
+        }
+    }
+
+    solution.schedule(permutation, this->active);
+
+    if (this->decode_cache) {
+        this->decode_cache->insert(key, solution.value);
+    }
+
+    return pagmo::vector_double(solution.value.begin(), solution.value.end());
+}
+
+std::pair<pagmo::vector_double, pagmo::vector_double> Problem::get_bounds()
+    const {
+    return std::make_pair(
+            pagmo::vector_double(2 * this->instance->total_num_operations, 0.0),
+            pagmo::vector_double(2 * this->instance->total_num_operations, 1.0));
+}
+
+pagmo::vector_double::size_type Problem::get_nobj() const {
+    return this->instance->num_objectives;
+}
+
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "instance/instance.hpp"
+#include "solution/key_precision.hpp"
+#include "solver/decode_cache.hpp"
+#include <pagmo/types.hpp>
+#include <memory>
+
+namespace mofjssp {
+
+class Problem {
+    public:
+    std::shared_ptr<const Instance> instance;
+
+    std::shared_ptr<Decode_Cache> decode_cache;
+
+    bool active = false;
+
+    Key_Precision key_precision = Key_Precision::DOUBLE;
+
+    Problem(const std::shared_ptr<const Instance> & instance,
+            const std::shared_ptr<Decode_Cache> & decode_cache = nullptr,
+            bool active = false,
+            Key_Precision key_precision = Key_Precision::DOUBLE);
+
+    Problem();
+
+    pagmo::vector_double fitness(const pagmo::vector_double & dv) const;
+
+    std::pair<pagmo::vector_double, pagmo::vector_double> get_bounds() const;
+
+    pagmo::vector_double::size_type get_nobj() const;
+};
+
+}
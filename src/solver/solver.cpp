@@ -1,14 +1,39 @@
 #include "solver/solver.hpp"
+#include "solver/indicators.hpp"
+#include "utils/thread_pool.hpp"
+#include <algorithm>
+#include <iterator>
+#include <numeric>
 
 namespace mofjssp {
 
 Solver::Solver(const Instance & instance)
-    : instance(instance) {
+    : Solver(std::make_shared<const Instance>(instance)) {}
+
+Solver::Solver(const std::shared_ptr<const Instance> & instance)
+    : instance(instance),
+      initial_individuals(instance->num_objectives,
+                          2 * instance->total_num_operations) {
     this->set_seed(this->seed);
 }
 
 Solver::Solver() = default;
 
+Solver::Solver(const Solver & solver) = default;
+
+Solver::Solver(Solver && solver) = default;
+
+Solver & Solver::operator = (Solver && solver) = default;
+
+void Solver::reset_decode_cache() {
+    if (this->decode_cache_size > 0) {
+        this->decode_cache =
+            std::make_shared<Decode_Cache>(this->decode_cache_size);
+    } else {
+        this->decode_cache = nullptr;
+    }
+}
+
 void Solver::set_seed(unsigned seed) {
     this->seed = seed;
     this->rng.seed(this->seed);
@@ -49,50 +74,7 @@ bool Solver::update_best_individuals(
             const std::vector<
                 std::pair<std::vector<double>, std::vector<double>>> & new_individuals,
             const std::vector<NSBRKGA::Sense> & senses) {
-    bool result = false;
-
-    if (new_individuals.empty()) {
-        return result;
-    }
-
-    auto non_dominated_new_individuals =
-        NSBRKGA::Population::nonDominatedSort<std::vector<double>>(new_individuals,
-                                                                   senses).front();
-
-    for (const auto & new_individual : non_dominated_new_individuals) {
-        bool is_dominated_or_equal = false;
-
-        for (auto it  = best_individuals.begin();
-                 it != best_individuals.end();) {
-            auto individual = *it;
-
-            if (Solution::dominates(new_individual.first, individual.first)) {
-                it = best_individuals.erase(it);
-            } else {
-                if (Solution::dominates(individual.first,
-                                        new_individual.first)
-                        || std::equal(individual.first.begin(),
-                                      individual.first.end(),
-                                      new_individual.first.begin(),
-                                      [](const double & a, const double & b) {
-                                            return fabs(a - b) <
-                                                std::numeric_limits<double>::epsilon();
-                                      })) {
-                    is_dominated_or_equal = true;
-                    break;
-                }
-
-                it++;
-            }
-        }
-
-        if (!is_dominated_or_equal) {
-            best_individuals.push_back(new_individual);
-            result = true;
-        }
-    }
-
-    return result;
+    return Archive::update(best_individuals, new_individuals, senses);
 }
 
 bool Solver::update_best_individuals(
@@ -105,34 +87,138 @@ bool Solver::update_best_individuals(
                                                   new_individuals,
                                                   senses);
 
-    if(best_individuals.size() > max_num_solutions) {
-        NSBRKGA::Population::crowdingSort<std::vector<double>>(best_individuals);
-        best_individuals.resize(max_num_solutions);
-        result = true;
-    }
-
-    return result;
+    return Archive::truncate(best_individuals, max_num_solutions) || result;
 }
 
 bool Solver::update_best_individuals(
             const std::vector<
                 std::pair<std::vector<double>,
                           std::vector<double>>> & new_individuals) {
-    bool result = Solver::update_best_individuals(
-            this->best_individuals,
-            new_individuals,
-            this->instance.senses);
+    MOFJSSP_PROFILE_SCOPE(ARCHIVE_UPDATE);
+
+    // The keys are kept in the precision in which they were decoded, so
+    // that they decode to the same values
+    const std::vector<std::pair<std::vector<double>, std::vector<double>>> *
+        individuals = &new_individuals;
+    std::vector<std::pair<std::vector<double>, std::vector<double>>>
+        quantized_individuals;
+
+    if (this->key_precision != Key_Precision::DOUBLE) {
+        quantized_individuals = new_individuals;
 
-    if (this->best_individuals.size() > this->max_num_solutions) {
-        NSBRKGA::Population::crowdingSort<std::vector<double>>(
-                this->best_individuals);
-        this->best_individuals.resize(this->max_num_solutions);
-        result = true;
+        for (auto & individual : quantized_individuals) {
+            quantize(individual.second, this->key_precision);
+        }
+
+        individuals = &quantized_individuals;
+    }
+
+    if (this->archive) {
+        this->archive->publish(*individuals);
+    }
+
+    std::vector<std::vector<double>> previous_values;
+
+    if (!this->hypervolume_targets.empty()) {
+        previous_values.reserve(this->best_individuals.size());
+
+        for (const auto & individual : this->best_individuals) {
+            previous_values.push_back(individual.first);
+        }
+    }
+
+    bool result;
+
+    if (this->truncation == Truncation::HYPERVOLUME_CONTRIBUTION) {
+        if (!this->hypervolume_contributions) {
+            this->hypervolume_contributions =
+                std::make_shared<Hypervolume_Contributions>(
+                        this->instance->senses,
+                        this->instance->primal_bound);
+        }
+
+        result = Solver::update_best_individuals(this->best_individuals,
+                                                 *individuals,
+                                                 this->instance->senses);
+        result = this->hypervolume_contributions->truncate(
+                this->best_individuals, this->max_num_solutions) || result;
+    } else {
+        result = Solver::update_best_individuals(this->best_individuals,
+                                                 *individuals,
+                                                 this->instance->senses,
+                                                 this->max_num_solutions);
+    }
+
+    if (result && !this->hypervolume_targets.empty()) {
+        this->update_hypervolume_ratio(previous_values);
     }
 
     return result;
 }
 
+void Solver::update_hypervolume_ratio(
+        const std::vector<std::vector<double>> & previous_values) {
+    const std::vector<double> & reference_point = this->instance->primal_bound;
+    std::vector<std::vector<double>> values, added_values, removed_values;
+    double box_volume = 1.0;
+
+    for (double bound : reference_point) {
+        box_volume *= bound;
+    }
+
+    for (const auto & individual : this->best_individuals) {
+        values.push_back(individual.first);
+    }
+
+    std::vector<std::vector<double>> sorted_previous_values(previous_values);
+
+    std::sort(values.begin(), values.end());
+    std::sort(sorted_previous_values.begin(), sorted_previous_values.end());
+    std::set_difference(values.begin(), values.end(),
+                        sorted_previous_values.begin(),
+                        sorted_previous_values.end(),
+                        std::back_inserter(added_values));
+    std::set_difference(sorted_previous_values.begin(),
+                        sorted_previous_values.end(),
+                        values.begin(), values.end(),
+                        std::back_inserter(removed_values));
+
+    // A contribution is exact even for dominated values, so the added
+    // values are contributed to the previous ones, and the removed values
+    // are then taken back from the union
+    std::vector<std::vector<double>> front(previous_values);
+
+    for (const auto & value : added_values) {
+        this->hypervolume_ratio += Indicators::hypervolume_contribution(
+                this->instance->senses, reference_point, front, value) /
+            box_volume;
+        front.push_back(value);
+    }
+
+    for (const auto & value : removed_values) {
+        front.erase(std::find(front.begin(), front.end(), value));
+        this->hypervolume_ratio -= Indicators::hypervolume_contribution(
+                this->instance->senses, reference_point, front, value) /
+            box_volume;
+    }
+
+    this->hypervolume_target_times.resize(
+            this->hypervolume_targets.size(),
+            std::numeric_limits<double>::infinity());
+    this->hypervolume_target_iterations.resize(
+            this->hypervolume_targets.size(),
+            std::numeric_limits<unsigned>::max());
+
+    for (unsigned i = 0; i < this->hypervolume_targets.size(); i++) {
+        if (this->hypervolume_ratio >= this->hypervolume_targets[i] &&
+                this->hypervolume_target_iterations[i] ==
+                    std::numeric_limits<unsigned>::max()) {
+            this->hypervolume_target_times[i] = this->elapsed_time();
+            this->hypervolume_target_iterations[i] = this->num_iterations;
+        }
+    }
+}
+
 bool Solver::update_best_individuals(const pagmo::population & pop) {
     std::vector<std::pair<std::vector<double>, std::vector<double>>>
         new_individuals(pop.size());
@@ -144,17 +230,135 @@ bool Solver::update_best_individuals(const pagmo::population & pop) {
     return this->update_best_individuals(new_individuals);
 }
 
+std::vector<std::pair<std::vector<double>, std::vector<double>>>
+        Solver::improve_best_individuals(unsigned num_individuals) {
+    MOFJSSP_PROFILE_SCOPE(LOCAL_SEARCH);
+
+    Local_Search local_search(*this->instance);
+
+    local_search.active = this->active_schedule;
+    std::vector<std::pair<std::vector<double>, std::vector<double>>>
+        improved_individuals;
+    std::vector<std::size_t> indices(this->best_individuals.size());
+
+    std::iota(indices.begin(), indices.end(), 0);
+
+    // A random sample, drawn by a partial shuffle
+    if (num_individuals < indices.size()) {
+        for (std::size_t i = 0; i < num_individuals; i++) {
+            std::swap(indices[i],
+                      indices[i + this->rng() % (indices.size() - i)]);
+        }
+
+        indices.resize(num_individuals);
+    }
+
+    for (const std::size_t & i : indices) {
+        auto individual = this->best_individuals[i];
+
+        if (local_search.improve(individual.second, individual.first)) {
+            improved_individuals.push_back(std::move(individual));
+        }
+    }
+
+    this->num_local_search_improvements += local_search.num_improvements;
+    this->num_local_search_evaluations += local_search.num_evaluations;
+
+    if (!improved_individuals.empty()) {
+        this->update_best_individuals(improved_individuals);
+    }
+
+    return improved_individuals;
+}
+
+void Solver::improve_best_individuals(pagmo::population & pop) {
+    if (pop.size() == 0) {
+        return;
+    }
+
+    for (const auto & individual :
+            this->improve_best_individuals(this->local_search_sample_size)) {
+        pop.set_xf(this->rng() % pop.size(),
+                   individual.second,
+                   individual.first);
+    }
+}
+
+void Solver::materialize_best_solutions() {
+    MOFJSSP_PROFILE_SCOPE(MATERIALIZATION);
+
+    const std::size_t num_solutions = this->best_individuals.size();
+
+    // Each thread builds a contiguous range of at least 16 solutions
+    const unsigned num_arenas = std::max<std::size_t>(1, std::min<std::size_t>(
+                this->num_materialization_threads,
+                (num_solutions + 15) / 16));
+    const std::size_t num_solutions_of_arena =
+        (num_solutions + num_arenas - 1) / num_arenas;
+    const auto pool = std::make_shared<Solution_Pool>(*this->instance,
+                                                      num_solutions_of_arena,
+                                                      num_arenas);
+    std::vector<std::vector<Solution>> solutions_of_arena(num_arenas);
+
+    auto materialize = [this, num_solutions, num_solutions_of_arena, &pool,
+                        &solutions_of_arena](unsigned arena) {
+        const std::size_t first = arena * num_solutions_of_arena,
+                          last = std::min(num_solutions,
+                                          first + num_solutions_of_arena);
+
+        solutions_of_arena[arena].reserve(last - first);
+
+        for (std::size_t i = first; i < last; i++) {
+            solutions_of_arena[arena].emplace_back(
+                    *this->instance,
+                    this->best_individuals[i].second,
+                    this->active_schedule,
+                    pool,
+                    arena);
+        }
+    };
+
+    if (num_arenas == 1) {
+        materialize(0);
+    } else {
+        Thread_Pool thread_pool(num_arenas);
+
+        for (unsigned arena = 0; arena < num_arenas; arena++) {
+            thread_pool.submit([&materialize, arena]() {
+                materialize(arena);
+            });
+        }
+
+        thread_pool.wait();
+    }
+
+    this->best_solutions.clear();
+    this->best_solutions.reserve(num_solutions);
+
+    for (auto & solutions : solutions_of_arena) {
+        for (auto & solution : solutions) {
+            this->best_solutions.push_back(std::move(solution));
+        }
+    }
+}
+
 void Solver::capture_snapshot(const pagmo::population & pop) {
+    MOFJSSP_PROFILE_SCOPE(SNAPSHOT);
+
     double time_snapshot = this->elapsed_time();
 
     this->best_solutions_snapshots.emplace_back(std::make_tuple(
                 this->num_iterations,
                 time_snapshot,
-                std::vector<std::vector<double>>(
-                    this->best_individuals.size())));
-    for (std::size_t i = 0; i < this->best_individuals.size(); i++) {
-        std::get<2>(this->best_solutions_snapshots.back())[i] =
-            this->best_individuals[i].first;
+                Population_Matrix(this->instance->num_objectives)));
+
+    Population_Matrix & best_values =
+        std::get<2>(this->best_solutions_snapshots.back());
+
+    best_values.reserve(this->best_individuals.size());
+
+    for (const auto & individual : this->best_individuals) {
+        best_values.push_back(individual.first);
     }
 
     f = pop.get_f();
@@ -165,9 +369,8 @@ void Solver::capture_snapshot(const pagmo::population & pop) {
         this->current_individuals[i] = std::make_pair(f[i], pop.get_x()[i]);
     }
 
-    this->fronts = NSBRKGA::Population::nonDominatedSort<std::vector<double>>(
-            current_individuals,
-            this->instance.senses);
+    this->fronts = Non_Dominated_Sort::sort(current_individuals,
+                                            this->instance->senses);
 
     this->num_non_dominated_snapshots.push_back(std::make_tuple(
                 this->num_iterations,
@@ -182,7 +385,17 @@ void Solver::capture_snapshot(const pagmo::population & pop) {
     this->populations_snapshots.push_back(std::make_tuple(
                 this->num_iterations,
                 time_snapshot,
-                std::vector<std::vector<std::vector<double>>>(1, f)));
+                std::vector<Population_Matrix>(
+                    1, Population_Matrix(this->instance->num_objectives))));
+
+    Population_Matrix & values =
+        std::get<2>(this->populations_snapshots.back()).front();
+
+    values.reserve(f.size());
+
+    for (const auto & value : f) {
+        values.push_back(value);
+    }
 
     this->time_last_snapshot = time_snapshot;
     this->iteration_last_snapshot = this->num_iterations;
@@ -190,10 +403,10 @@ void Solver::capture_snapshot(const pagmo::population & pop) {
 }
 
 std::ostream & operator <<(std::ostream & os, const Solver & solver) {
-    os << "Number of jobs: " << solver.instance.num_jobs << std::endl
-       << "Total number of operations: " << solver.instance.total_num_operations
+    os << "Number of jobs: " << solver.instance->num_jobs << std::endl
+       << "Total number of operations: " << solver.instance->total_num_operations
        << std::endl
-       << "Number of machines: " << solver.instance.num_machines << std::endl
+       << "Number of machines: " << solver.instance->num_machines << std::endl
        << "Seed: " << solver.seed << std::endl
        << "Time limit: " << solver.time_limit << std::endl
        << "Iterations limit: " << solver.iterations_limit << std::endl
@@ -218,7 +431,53 @@ std::ostream & operator <<(std::ostream & os, const Solver & solver) {
        << "Number of iteration of the next snapshot: "
        << solver.iteration_next_snapshot << std::endl
        << "Iteration when the last snapshot was taken: "
-       << solver.iteration_last_snapshot << std::endl;
+       << solver.iteration_last_snapshot << std::endl
+       << "Decode cache size: " << solver.decode_cache_size << std::endl
+       << "Active schedule: " << solver.active_schedule << std::endl
+       << "Key precision: " << to_string(solver.key_precision) << std::endl
+       << "Truncation: " << to_string(solver.truncation) << std::endl
+       << "Local search: " << solver.local_search << std::endl
+       << "Local search interval: " << solver.local_search_interval
+       << std::endl
+       << "Local search sample size: " << solver.local_search_sample_size
+       << std::endl
+       << "Local search improvements: "
+       << solver.num_local_search_improvements << std::endl
+       << "Local search evaluations: "
+       << solver.num_local_search_evaluations << std::endl;
+
+    if (!solver.hypervolume_targets.empty()) {
+        os << "Hypervolume ratio: " << solver.hypervolume_ratio << std::endl;
+
+        for (unsigned i = 0; i < solver.hypervolume_targets.size(); i++) {
+            os << "Time to hypervolume ratio "
+               << solver.hypervolume_targets[i] << ": "
+               << (i < solver.hypervolume_target_times.size() ?
+                       solver.hypervolume_target_times[i] :
+                       std::numeric_limits<double>::infinity())
+               << std::endl
+               << "Iterations to hypervolume ratio "
+               << solver.hypervolume_targets[i] << ": ";
+
+            if (i < solver.hypervolume_target_iterations.size() &&
+                    solver.hypervolume_target_iterations[i] !=
+                        std::numeric_limits<unsigned>::max()) {
+                os << solver.hypervolume_target_iterations[i] << std::endl;
+            } else {
+                os << "inf" << std::endl;
+            }
+        }
+    }
+
+    if (solver.decode_cache) {
+        os << "Decode cache hits: " << solver.decode_cache->num_hits
+           << std::endl
+           << "Decode cache misses: " << solver.decode_cache->num_misses
+           << std::endl
+           << "Decode cache hit rate: " << solver.decode_cache->hit_rate()
+           << std::endl;
+    }
+
     return os;
 }
 
@@ -1,6 +1,11 @@
 #pragma once
 
-#include "solution/solution.hpp"
+#include "solver/archive.hpp"
+#include "solver/decode_cache.hpp"
+#include "solver/hypervolume_contributions.hpp"
+#include "solver/local_search.hpp"
+#include "solver/population_matrix.hpp"
+#include "utils/profiler.hpp"
 #include <pagmo/population.hpp>
 
 namespace mofjssp {
@@ -10,10 +15,11 @@ namespace mofjssp {
  ********************************************************/
 class Solver {
     public:
-    /****************************
-     * The instance been solved.
-     ****************************/
-    Instance instance;
+    /***************************************************************
+     * The instance been solved, shared read-only with the problems
+     * and with other solvers of the same instance.
+     ***************************************************************/
+    std::shared_ptr<const Instance> instance;
 
     /****************************************************************
      * The seed for the pseudo-random numbers generator.
@@ -47,10 +53,10 @@ class Solver {
     unsigned max_num_snapshots = 0;
 
     /****************************************************************
-     * The initial individuals.
+     * The objective values and keys of the initial individuals (the
+     * NSBRKGA solver decodes their values from their keys).
      ****************************************************************/
-    std::vector<std::pair<std::vector<double>, std::vector<double>>>
-        initial_individuals = {};
+    Population_Matrix initial_individuals;
 
     /*************************************
      * The number of iterations executed.
@@ -58,11 +64,112 @@ class Solver {
     unsigned num_iterations = 0;
 
     /****************************************************************
-     * The best individuals found.
+     * The best individuals found, as a (value, key) front, on which
+     * the archive, the hypervolume contributions and the crowding
+     * sort of NSBRKGA operate; unlike the initial individuals and
+     * the snapshots, they are not stored in a population matrix.
      ****************************************************************/
     std::vector<std::pair<std::vector<double>, std::vector<double>>>
         best_individuals = {};
 
+    /*****************************************************************
+     * The archive shared with other solvers or threads, to which the
+     * new individuals are also published (none by default).
+     *****************************************************************/
+    std::shared_ptr<Archive> archive = nullptr;
+
+    /*******************************************************************
+     * The maximum number of objective values cached by the decode cache
+     * (no cache if 0).
+     *******************************************************************/
+    unsigned decode_cache_size = 0;
+
+    /***************************************************************
+     * Whether the keys are decoded into active schedules, in which
+     * each operation starts in the earliest idle interval of its
+     * machine where it fits, instead of semi-active schedules.
+     ***************************************************************/
+    bool active_schedule = false;
+
+    /***************************************************************
+     * The precision in which the keys are decoded and the keys of
+     * the best individuals are kept.
+     ***************************************************************/
+    Key_Precision key_precision = Key_Precision::DOUBLE;
+
+    /*********************************************************
+     * The decode cache of the last solve, if any.
+     *********************************************************/
+    std::shared_ptr<Decode_Cache> decode_cache = nullptr;
+
+    /*****************************************************************
+     * Whether the best individuals are improved by local search at
+     * the end of the solve.
+     *****************************************************************/
+    bool local_search = false;
+
+    /*****************************************************************
+     * The number of iterations between improvements of the best
+     * individuals by local search during the solve (never if 0).
+     *****************************************************************/
+    unsigned local_search_interval = 0;
+
+    /*****************************************************************
+     * The number of best individuals, drawn at random, improved by
+     * local search at each interval (all of them at the end).
+     *****************************************************************/
+    unsigned local_search_sample_size = 16;
+
+    /***************************************************************
+     * The number of moves accepted and of evaluations performed by
+     * the local search.
+     ***************************************************************/
+    unsigned num_local_search_improvements = 0;
+
+    unsigned num_local_search_evaluations = 0;
+
+    /*****************************************************************
+     * The hypervolume ratios whose times to target are recorded, a
+     * ratio being the fraction of the box between the origin and the
+     * primal bound of the instance dominated by the best individuals
+     * (the hypervolume is not tracked if there are none).
+     *****************************************************************/
+    std::vector<double> hypervolume_targets = {};
+
+    /*****************************************************************
+     * The hypervolume ratio of the best individuals, updated with the
+     * contributions of the individuals added to and removed from them.
+     *****************************************************************/
+    double hypervolume_ratio = 0.0;
+
+    /*****************************************************************
+     * The time and the iteration at which the hypervolume ratio first
+     * reached each target (infinity and the maximum unsigned if not).
+     *****************************************************************/
+    std::vector<double> hypervolume_target_times = {};
+
+    std::vector<unsigned> hypervolume_target_iterations = {};
+
+    /*****************************************************************
+     * How the best individuals are truncated to the maximum number of
+     * solutions.
+     *****************************************************************/
+    Truncation truncation = Truncation::CROWDING_DISTANCE;
+
+    /*****************************************************************
+     * The contributions of the best individuals, kept up to date if
+     * they are truncated by hypervolume contribution.
+     *****************************************************************/
+    std::shared_ptr<Hypervolume_Contributions> hypervolume_contributions =
+        nullptr;
+
+    /*****************************************************************
+     * The number of threads that decode the best individuals into
+     * the solutions found.
+     *****************************************************************/
+    unsigned num_materialization_threads =
+        std::max(1u, std::thread::hardware_concurrency());
+
     /******************************************
      * The solutions found.
      ******************************************/
@@ -112,8 +219,8 @@ class Solver {
      * Snapshots of the best solutions, containing the iteration, time and
      * Solutions' costs.
      **********************************************************************/
-    std::vector<std::tuple<unsigned, double,
-        std::vector<std::vector<double>>>> best_solutions_snapshots = {};
+    std::vector<std::tuple<unsigned, double, Population_Matrix>>
+        best_solutions_snapshots = {};
 
     /*****************************************************************
      * Snapshots of the number of non-dominated individuals in each
@@ -135,9 +242,8 @@ class Solver {
      * Snapshots of the populations, containing the iteration, time and
      * Solutions' costs.
      *******************************************************************/
-    std::vector<std::tuple<unsigned, double,
-        std::vector<std::vector<std::vector<double>>>>>
-            populations_snapshots = {};
+    std::vector<std::tuple<unsigned, double, std::vector<Population_Matrix>>>
+        populations_snapshots = {};
 
     /*************************************************
      * The start time.
@@ -168,11 +274,48 @@ class Solver {
      *********************************************/
     Solver(const Instance & instance);
 
+    /*********************************************
+     * Constructs a new solver.
+     *
+     * @param instance the instance to be solved.
+     *********************************************/
+    Solver(const std::shared_ptr<const Instance> & instance);
+
     /*********************************
      * Constructs a new empty solver.
      *********************************/
     Solver();
 
+    /*****************************************
+     * Copy constructor.
+     *
+     * @param solver the solver been copied.
+     *****************************************/
+    Solver(const Solver & solver);
+
+    /*************************************************************
+     * Move constructor. The instance is shared, not duplicated.
+     *
+     * @param solver the solver been moved.
+     *************************************************************/
+    Solver(Solver && solver);
+
+    /***************************************************************
+     * Move assignment operator. There is no copy assignment, since
+     * the solutions found are not assignable.
+     *
+     * @param solver the solver been moved.
+     *
+     * @return this solver.
+     ***************************************************************/
+    Solver & operator = (Solver && solver);
+
+    /*****************************************************************
+     * Creates a new decode cache of the configured size, or none if
+     * the size is 0.
+     *****************************************************************/
+    void reset_decode_cache();
+
     /********************************************************************
      * Sets the seed for the pseudo-random numbers generator.
      *
@@ -281,6 +424,45 @@ class Solver {
      **********************************************************************/
     bool update_best_individuals(const pagmo::population & pop);
 
+    /*******************************************************************
+     * Improves the best individuals, or a random sample of them, by
+     * local search, and updates the best individuals with the improved
+     * ones.
+     *
+     * @param num_individuals the number of best individuals improved.
+     *
+     * @return the improved individuals.
+     *******************************************************************/
+    std::vector<std::pair<std::vector<double>, std::vector<double>>>
+        improve_best_individuals(unsigned num_individuals =
+                                    std::numeric_limits<unsigned>::max());
+
+    /*******************************************************************
+     * Improves a sample of the best individuals by local search,
+     * updates the best individuals with the improved ones and injects
+     * them into the population, in place of random individuals.
+     *
+     * @param pop the current population.
+     *******************************************************************/
+    void improve_best_individuals(pagmo::population & pop);
+
+    /*****************************************************************
+     * Updates the hypervolume ratio of the best individuals after they
+     * changed, and records the targets it reached.
+     *
+     * @param previous_values the objective values of the previous best
+     *                        individuals.
+     *****************************************************************/
+    void update_hypervolume_ratio(
+            const std::vector<std::vector<double>> & previous_values);
+
+    /*****************************************************************
+     * Decodes the best individuals into the solutions found, in
+     * parallel, each thread allocating its solutions from its own
+     * arena of a new solution pool.
+     *****************************************************************/
+    void materialize_best_solutions();
+
     /*****************************************************
      * Capture a snapshot of the current population.
      *
@@ -0,0 +1,90 @@
+#include "solver/archive.hpp"
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <random>
+
+int main() {
+    const std::vector<NSBRKGA::Sense> senses(4, NSBRKGA::Sense::MINIMIZE);
+    const unsigned num_threads = 4, num_batches = 50, batch_size = 20;
+    std::vector<mofjssp::Archive::Front> batches(num_threads * num_batches);
+    std::mt19937 rng(2351389233);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    for (auto & batch : batches) {
+        for (unsigned i = 0; i < batch_size; i++) {
+            std::vector<double> value(senses.size());
+
+            for (double & v : value) {
+                v = distribution(rng);
+            }
+
+            batch.push_back(std::make_pair(value, std::vector<double>()));
+        }
+    }
+
+    for (const unsigned max_num_solutions :
+            {std::numeric_limits<unsigned>::max(), 64u}) {
+        std::cout << "Maximum number of solutions: " << max_num_solutions
+                  << std::endl;
+
+        mofjssp::Archive archive(senses, max_num_solutions, 64, num_threads);
+        std::vector<std::thread> threads;
+
+        for (unsigned t = 0; t < num_threads; t++) {
+            threads.emplace_back([&archive, &batches, t]() {
+                for (unsigned b = t; b < batches.size(); b += num_threads) {
+                    archive.publish(batches[b]);
+                }
+            });
+        }
+
+        for (auto & thread : threads) {
+            thread.join();
+        }
+
+        // The merger thread merges the batches without any flush
+        for (unsigned i = 0; i < 1000 && archive.size() == 0; i++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        assert(archive.size() > 0);
+
+        archive.flush();
+
+        const auto front = archive.snapshot();
+
+        assert(front->size() > 0);
+        assert(front->size() <= max_num_solutions);
+
+        for (const auto & a : *front) {
+            for (const auto & b : *front) {
+                assert(!mofjssp::Solution::dominates(a.first, b.first));
+            }
+        }
+
+        if (max_num_solutions == std::numeric_limits<unsigned>::max()) {
+            // Without truncation, the front must match the sequential one
+            mofjssp::Archive::Front sequential_front;
+
+            for (const auto & batch : batches) {
+                mofjssp::Archive::update(sequential_front, batch, senses);
+            }
+
+            assert(front->size() == sequential_front.size());
+
+            for (const auto & a : sequential_front) {
+                assert(std::find_if(front->begin(), front->end(),
+                            [&a](const auto & b) {
+                                return a.first == b.first;
+                            }) != front->end());
+            }
+        }
+
+        std::cout << "Front size: " << front->size() << std::endl;
+    }
+
+    std::cout << std::endl << "Archive Test PASSED" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include "utils/argument_parser.hpp"
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+int main() {
+    const std::string filename = "argument_parser_test_tokens.txt",
+                      runs_filename = "argument_parser_test_runs.csv";
+    std::ofstream ofs;
+
+    ofs.open(filename);
+    ofs << "--seed-0 7\n--seed-1 8 --verbose" << std::endl;
+    ofs.close();
+
+    ofs.open(runs_filename);
+    ofs << "solver,seed,hypervolume\n"
+        << "nsga2,1,h0.txt\n"
+        << "nsga2,2,\n"
+        << "\n"
+        << "moead,3,h2.txt" << std::endl;
+    ofs.close();
+
+    std::vector<std::string> arguments = {"exec",
+                                          "--instance", "mk01.txt",
+                                          "--pareto", "a", "b",
+                                          "--pareto-1", "c",
+                                          "--pareto", "d",
+                                          "@" + filename,
+                                          "--time-limit", "-1",
+                                          "--runs", runs_filename};
+    std::vector<char *> argv;
+
+    for (std::string & argument : arguments) {
+        argv.push_back(&argument[0]);
+    }
+
+    Argument_Parser arg_parser(argv.size(), argv.data());
+
+    std::remove(filename.c_str());
+    std::remove(runs_filename.c_str());
+
+    assert(arg_parser.tokens.size() == 18);
+    assert(arg_parser.option_value("--instance") == "mk01.txt");
+    assert(arg_parser.option_value("--time-limit") == "-1");
+
+    // The values of a repeated option are listed, and those not given
+    // as indexed options are their values
+    assert((arg_parser.option_values("--pareto") ==
+            std::vector<std::string>{"a", "b", "d"}));
+    assert(arg_parser.option_value("--pareto-0") == "a");
+    assert(arg_parser.option_value("--pareto-1") == "c");
+    assert(arg_parser.option_value("--pareto-2") == "d");
+    assert(!arg_parser.option_exists("--pareto-3"));
+
+    // The tokens of the file
+    assert(arg_parser.option_value("--seed-0") == "7");
+    assert(arg_parser.option_value("--seed-1") == "8");
+    assert(arg_parser.option_exists("--verbose"));
+    assert(arg_parser.option_value("--verbose").empty());
+    assert(arg_parser.option_values("--verbose").empty());
+
+    // The runs, whose options given are kept and whose empty fields are
+    // skipped
+    assert(arg_parser.option_value("--solver-0") == "nsga2");
+    assert(arg_parser.option_value("--seed-0") == "7");
+    assert(arg_parser.option_value("--seed-2") == "3");
+    assert(arg_parser.option_value("--hypervolume-0") == "h0.txt");
+    assert(!arg_parser.option_exists("--hypervolume-1"));
+    assert(arg_parser.option_value("--hypervolume-2") == "h2.txt");
+    assert(!arg_parser.option_exists("--solver-3"));
+
+    assert(!arg_parser.option_exists("--reference-pareto"));
+    assert(arg_parser.option_value("--reference-pareto").empty());
+
+    std::cout << std::endl << "Argument Parser Test PASSED" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include "solver/decode_cache.hpp"
+#include "solution/solution.hpp"
+#include <cassert>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+int main() {
+    std::ifstream ifs;
+    mofjssp::Instance instance;
+    std::mt19937 rng(2351389233);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    for (const std::string filename : {"instances/mk01.txt",
+                                       "instances/mk05.txt",
+                                       "instances/mk10.txt",
+                                       "instances/mk15.txt"}) {
+        std::cout << filename << std::endl;
+
+        ifs.open(filename);
+
+        assert(ifs.is_open());
+
+        ifs >> instance;
+
+        ifs.close();
+
+        mofjssp::Decode_Cache cache(64, 4);
+
+        for (unsigned i = 0; i < 256; i++) {
+            std::vector<double> key(2 * instance.total_num_operations),
+                                other_key(key.size());
+
+            for (double & k : key) {
+                k = distribution(rng);
+            }
+
+            // Halving the sequence keys keeps the order of the operations,
+            // so both keys decode to the same schedule
+            for (unsigned j = 0; j < key.size(); j++) {
+                other_key[j] = j < instance.total_num_operations ?
+                    key[j] : key[j] / 2.0;
+            }
+
+            mofjssp::Solution solution(instance, key),
+                              other_solution(instance, other_key);
+            auto machine_of_operation = solution.machine_of_operation;
+            std::vector<std::pair<double, unsigned>> permutation,
+                                                     other_permutation;
+            mofjssp::Objectives<> value;
+
+            mofjssp::Solution::decode(instance, key, machine_of_operation,
+                                      permutation);
+            mofjssp::Solution::decode(instance, other_key,
+                                      machine_of_operation,
+                                      other_permutation);
+
+            const auto cache_key = mofjssp::Decode_Cache::key(
+                    machine_of_operation, permutation);
+
+            assert(cache_key == mofjssp::Decode_Cache::key(
+                        machine_of_operation, other_permutation));
+            assert(!cache.find(cache_key, value));
+
+            cache.insert(cache_key, solution.value);
+
+            assert(cache.find(cache_key, value));
+            assert(value == other_solution.value);
+            assert(cache.size() <= cache.max_size);
+        }
+
+        assert(cache.num_hits == 256);
+        assert(cache.num_misses == 256);
+        assert(fabs(cache.hit_rate() - 0.5) <
+                std::numeric_limits<double>::epsilon());
+    }
+
+    std::cout << std::endl << "Decode Cache Test PASSED" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,262 @@
+#include "solution/solution.hpp"
+#include "solver/nsbrkga/decoder.hpp"
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+int main() {
+    std::ifstream ifs;
+    mofjssp::Instance instance;
+    std::mt19937 rng(2351389233);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    unsigned num_boundary_operations[2] = {0, 0};
+
+    for (const std::string filename : {"instances/mk01.txt",
+                                       "instances/mk02.txt",
+                                       "instances/mk03.txt",
+                                       "instances/mk04.txt",
+                                       "instances/mk05.txt",
+                                       "instances/mk06.txt",
+                                       "instances/mk07.txt",
+                                       "instances/mk08.txt",
+                                       "instances/mk09.txt",
+                                       "instances/mk10.txt",
+                                       "instances/mk11.txt",
+                                       "instances/mk12.txt",
+                                       "instances/mk13.txt",
+                                       "instances/mk14.txt",
+                                       "instances/mk15.txt"}) {
+        std::cout << filename << std::endl;
+
+        ifs.open(filename);
+
+        assert(ifs.is_open());
+
+        ifs >> instance;
+
+        ifs.close();
+
+        // The full decoder decodes every chromosome from scratch
+        mofjssp::Decoder full_decoder(instance, 1),
+                         incremental_decoder(instance, 1),
+                         cached_decoder(instance, 1,
+                                 std::make_shared<mofjssp::Decode_Cache>(64));
+        NSBRKGA::Chromosome chromosome(2 * instance.total_num_operations);
+        std::uniform_int_distribution<unsigned> gene_distribution(
+                0, chromosome.size() - 1);
+
+        full_decoder.max_num_incremental_genes = 0;
+
+        assert(incremental_decoder.max_num_incremental_genes > 0);
+
+        for (double & allele : chromosome) {
+            allele = distribution(rng);
+        }
+
+        for (unsigned i = 0; i < 500; i++) {
+            const NSBRKGA::Chromosome parent = chromosome;
+
+            // Mostly small mutations, as in path relinking, and from time
+            // to time a large one, which is decoded from scratch
+            const unsigned num_mutations = i % 50 == 0 ?
+                chromosome.size() / 2 : 1 + i % 4;
+
+            for (unsigned j = 0; j < num_mutations; j++) {
+                chromosome[gene_distribution(rng)] = distribution(rng);
+            }
+
+            const std::vector<double> value =
+                full_decoder.decode(chromosome, false);
+
+            assert(value == incremental_decoder.decode(chromosome, false));
+            assert(value == cached_decoder.decode(chromosome, false));
+
+            // A subset of the objectives agrees with the full decode, and
+            // leaves the state of the decoder consistent for the next one
+            const unsigned objectives = 1 + i % mofjssp::ALL_OBJECTIVES;
+            const mofjssp::Objectives<> & subset =
+                incremental_decoder.evaluate(chromosome, objectives);
+
+            for (unsigned k = 0; k < value.size(); k++) {
+                assert(subset[k] == (objectives & (1u << k) ? value[k] : 0.0));
+            }
+
+            const mofjssp::Objectives<> & cached_subset =
+                cached_decoder.evaluate(chromosome, objectives);
+
+            for (unsigned k = 0; k < value.size(); k++) {
+                assert(cached_subset[k] ==
+                       (objectives & (1u << k) ? value[k] : 0.0));
+            }
+
+            // Going back to the parent is also an incremental decode,
+            // and it hits the cache
+            if (i % 7 == 0) {
+                NSBRKGA::Chromosome copy = parent;
+
+                assert(full_decoder.decode(copy, false) ==
+                       incremental_decoder.decode(copy, false));
+                assert(full_decoder.decode(copy, false) ==
+                       cached_decoder.decode(copy, false));
+            }
+        }
+
+        assert(cached_decoder.decode_cache->num_hits > 0);
+
+        // The active decoder agrees with the active schedule of a solution
+        mofjssp::Decoder active_decoder(instance, 1, nullptr, true);
+
+        for (unsigned i = 0; i < 50; i++) {
+            std::vector<double> key(chromosome.size());
+
+            for (double & allele : key) {
+                allele = distribution(rng);
+            }
+
+            chromosome = key;
+
+            std::vector<double> value = active_decoder.decode(chromosome, false);
+
+            assert(std::equal(value.begin(), value.end(),
+                              mofjssp::Solution(instance, key, true).value.begin()));
+
+            chromosome[gene_distribution(rng)] = distribution(rng);
+            key = chromosome;
+            value = active_decoder.decode(chromosome, false);
+
+            assert(std::equal(value.begin(), value.end(),
+                              mofjssp::Solution(instance, key, true).value.begin()));
+        }
+
+        // A quantized decoder decodes a key to the schedule of the key
+        // stored in its precision, which is the schedule of the original
+        // key whenever the quantization keeps the machines and the order
+        for (const auto precision : {mofjssp::Key_Precision::FLOAT,
+                                     mofjssp::Key_Precision::FIXED16}) {
+            mofjssp::Decoder decoder(instance, 1),
+                             quantized_decoder(instance, 1, nullptr, false,
+                                               precision);
+            mofjssp::Population_Matrix population(
+                    instance.num_objectives, chromosome.size(), precision);
+            unsigned num_lossless = 0;
+
+            for (unsigned i = 0; i < 50; i++) {
+                std::vector<double> key(chromosome.size());
+
+                for (double & allele : key) {
+                    allele = distribution(rng);
+                }
+
+                chromosome = key;
+                population.push_back(
+                        std::vector<double>(instance.num_objectives, 0.0),
+                        key);
+
+                const std::vector<double> value =
+                    quantized_decoder.decode(chromosome, false);
+                std::vector<double> quantized_key = key;
+
+                mofjssp::quantize(quantized_key, precision);
+
+                assert(quantized_key == population.key(i));
+                assert(value == decoder.decode(quantized_key, false));
+                assert(std::equal(value.begin(), value.end(),
+                                  mofjssp::Solution(instance,
+                                                    quantized_key).value.begin()));
+
+                auto machine_of_operation =
+                    mofjssp::Solution(instance).machine_of_operation;
+                auto quantized_machine_of_operation = machine_of_operation;
+                std::vector<std::pair<double, unsigned>> permutation,
+                                                         quantized_permutation;
+
+                mofjssp::Solution::decode(instance, chromosome,
+                                          machine_of_operation, permutation);
+                mofjssp::Solution::decode(instance, quantized_key,
+                                          quantized_machine_of_operation,
+                                          quantized_permutation);
+
+                if (machine_of_operation == quantized_machine_of_operation &&
+                        std::equal(permutation.begin(), permutation.end(),
+                                   quantized_permutation.begin(),
+                                   [](const auto & a, const auto & b) {
+                                       return a.second == b.second;
+                                   })) {
+                    const mofjssp::Solution solution(instance, chromosome),
+                          quantized_solution(instance, quantized_key);
+
+                    assert(value == decoder.decode(chromosome, false));
+                    assert(solution.starting_time_of_operation ==
+                           quantized_solution.starting_time_of_operation);
+                    num_lossless++;
+                }
+            }
+
+            // The decoder and the solutions select the same machines for
+            // alleles exactly on the bounds k / n of the intervals of the
+            // machines, which are 16-bit fixed-point numbers for n = 3, 5,
+            // 15 and 17
+            if (precision == mofjssp::Key_Precision::FIXED16) {
+                for (unsigned i = 0; i < 20; i++) {
+                    std::vector<double> key(chromosome.size());
+
+                    for (unsigned job = 0, gene = 0; job < instance.num_jobs; job++) {
+                        for (unsigned operation = 0;
+                             operation < instance.num_operations[job];
+                             operation++, gene++) {
+                            const unsigned num_machines =
+                                instance.machines_of_operation[job][operation].size();
+
+                            key[gene] = double(std::uniform_int_distribution<unsigned>(
+                                        0, num_machines)(rng)) / num_machines;
+                            key[instance.total_num_operations + gene] =
+                                distribution(rng);
+
+                            if (num_machines == 3 || num_machines == 5) {
+                                assert(mofjssp::quantize(key[gene], precision) ==
+                                       key[gene]);
+                                num_boundary_operations[num_machines == 5]++;
+                            }
+                        }
+                    }
+
+                    chromosome = key;
+
+                    const std::vector<double> value =
+                        quantized_decoder.decode(chromosome, false);
+
+                    mofjssp::quantize(key, precision);
+
+                    assert(std::equal(value.begin(), value.end(),
+                                      mofjssp::Solution(instance,
+                                                        key).value.begin()));
+                }
+            }
+
+            // Floats keep every schedule of these instances
+            assert(precision != mofjssp::Key_Precision::FLOAT ||
+                   num_lossless == 50);
+
+            // Decoding the stored keys gives the same values
+            mofjssp::Population_Matrix copy = population;
+
+            quantized_decoder.decode(copy);
+
+            for (std::size_t i = 0; i < population.size(); i++) {
+                std::vector<double> quantized_key = population.key(i);
+
+                assert(copy.value(i).vector() ==
+                       decoder.decode(quantized_key, false));
+            }
+        }
+    }
+
+    // Some operations of the instances have 3 and 5 eligible machines
+    assert(num_boundary_operations[0] > 0 && num_boundary_operations[1] > 0);
+
+    std::cout << std::endl << "Decoder Test PASSED" << std::endl;
+
+    return 0;
+}
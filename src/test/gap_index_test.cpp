@@ -0,0 +1,79 @@
+#include "solution/gap_index.hpp"
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <map>
+#include <random>
+
+// Inserts an operation by scanning every idle interval
+static double scan_insert(std::map<double, double> & gaps,
+                          double & end,
+                          double release_time,
+                          double processing_time) {
+    for (auto it = gaps.begin(); it != gaps.end(); it++) {
+        const auto [gap_start, gap_end] = *it;
+        const double start = std::max(gap_start, release_time);
+
+        if (start + processing_time <= gap_end) {
+            gaps.erase(it);
+
+            if (gap_start < start) {
+                gaps.emplace(gap_start, start);
+            }
+
+            if (start + processing_time < gap_end) {
+                gaps.emplace(start + processing_time, gap_end);
+            }
+
+            return start;
+        }
+    }
+
+    const double starting_time = std::max(release_time, end);
+
+    if (end < starting_time) {
+        gaps.emplace(end, starting_time);
+    }
+
+    end = starting_time + processing_time;
+
+    return starting_time;
+}
+
+int main() {
+    std::mt19937 rng(2351389233);
+    std::uniform_int_distribution<unsigned> release_distribution(0, 400),
+                                            processing_distribution(1, 20);
+    mofjssp::Gap_Index gap_index;
+
+    // The index starts each operation where the scan does
+    for (unsigned round = 0; round < 20; round++) {
+        std::map<double, double> gaps;
+        double end = 0.0;
+
+        gap_index.clear();
+
+        for (unsigned i = 0; i < 500; i++) {
+            const double release_time = release_distribution(rng),
+                         processing_time = processing_distribution(rng);
+
+            assert(gap_index.insert(release_time, processing_time) ==
+                   scan_insert(gaps, end, release_time, processing_time));
+            assert(gap_index.size() == gaps.size());
+            assert(gap_index.end == end);
+        }
+    }
+
+    // An operation fits exactly in an interval, which disappears
+    gap_index.clear();
+
+    assert(gap_index.insert(10.0, 5.0) == 10.0);
+    assert(gap_index.size() == 1);
+    assert(gap_index.insert(0.0, 10.0) == 0.0);
+    assert(gap_index.size() == 0);
+    assert(gap_index.insert(0.0, 1.0) == 15.0);
+
+    std::cout << std::endl << "Gap Index Test PASSED" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include "solver/hypervolume_contributions.hpp"
+#include "solver/indicators.hpp"
+#include <cassert>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+// The contribution of each point of a front, computed from scratch
+static void check_contributions(
+        const mofjssp::Hypervolume_Contributions & contributions,
+        const std::vector<std::vector<double>> & front) {
+    assert(contributions.size() == front.size());
+
+    for (unsigned i = 0; i < front.size(); i++) {
+        std::vector<std::vector<double>> others(front);
+
+        others.erase(others.begin() + i);
+
+        assert(std::fabs(contributions.contribution(front[i]) -
+                         mofjssp::Indicators::hypervolume_contribution(
+                             contributions.senses,
+                             contributions.reference_point,
+                             others,
+                             front[i])) < 1e-9);
+    }
+}
+
+int main() {
+    std::mt19937 rng(2351389233);
+    std::uniform_int_distribution<int> coordinate_distribution(0, 10);
+    const std::vector<NSBRKGA::Sense> senses = {
+        NSBRKGA::Sense::MINIMIZE,
+        NSBRKGA::Sense::MAXIMIZE,
+        NSBRKGA::Sense::MINIMIZE,
+        NSBRKGA::Sense::MINIMIZE
+    };
+    const std::vector<double> reference_point = {10.0, 0.0, 10.0, 10.0};
+
+    // The contributions are kept up to date as points, dominated or not,
+    // are inserted and erased
+    for (unsigned test = 0; test < 20; test++) {
+        mofjssp::Hypervolume_Contributions contributions(senses,
+                                                         reference_point);
+        std::vector<std::vector<double>> front;
+
+        for (unsigned step = 0; step < 60; step++) {
+            if (front.empty() || rng() % 3 != 0) {
+                std::vector<double> point(senses.size());
+
+                for (double & value : point) {
+                    value = coordinate_distribution(rng);
+                }
+
+                if (std::find(front.begin(), front.end(), point) !=
+                        front.end()) {
+                    continue;
+                }
+
+                contributions.insert(point);
+                front.push_back(point);
+            } else {
+                const unsigned i = rng() % front.size();
+
+                contributions.erase(front[i]);
+                front.erase(front.begin() + i);
+            }
+
+            check_contributions(contributions, front);
+        }
+    }
+
+    // The truncation evicts the least contributors of a front, i.e., the
+    // dominated points
+    {
+        mofjssp::Hypervolume_Contributions contributions(senses,
+                                                         reference_point);
+        mofjssp::Archive::Front front = {
+            {{1.0, 9.0, 1.0, 1.0}, {0.1}},
+            {{2.0, 8.0, 2.0, 2.0}, {0.2}},
+            {{1.5, 8.5, 1.5, 1.5}, {0.3}},
+            {{0.5, 1.0, 9.0, 9.0}, {0.4}}
+        };
+
+        assert(!contributions.truncate(front, 4));
+        assert(contributions.truncate(front, 2));
+        assert(front.size() == 2);
+        assert(contributions.size() == 2);
+        assert(contributions.contribution({1.0, 9.0, 1.0, 1.0}) > 0.0);
+        assert(contributions.contribution({0.5, 1.0, 9.0, 9.0}) > 0.0);
+    }
+
+    std::cout << std::endl << "Hypervolume Contributions Test PASSED"
+              << std::endl;
+
+    return 0;
+}
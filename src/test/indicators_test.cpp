@@ -0,0 +1,127 @@
+#include "solver/indicators.hpp"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+
+// The hypervolume of a front of minimization points by the
+// inclusion-exclusion principle over every subset of the front
+static double brute_force_hypervolume(
+        const std::vector<double> & reference_point,
+        const std::vector<std::vector<double>> & front) {
+    double volume = 0.0;
+
+    for (unsigned subset = 1; subset < (1u << front.size()); subset++) {
+        std::vector<double> corner(reference_point.size(), 0.0);
+        double box = 1.0;
+        int sign = -1;
+
+        for (unsigned i = 0; i < front.size(); i++) {
+            if (subset & (1u << i)) {
+                sign = -sign;
+
+                for (unsigned j = 0; j < corner.size(); j++) {
+                    corner[j] = std::max(corner[j], front[i][j]);
+                }
+            }
+        }
+
+        for (unsigned j = 0; j < corner.size(); j++) {
+            box *= std::max(0.0, reference_point[j] - corner[j]);
+        }
+
+        volume += sign * box;
+    }
+
+    return volume;
+}
+
+int main() {
+    std::mt19937 rng(2351389233);
+    std::uniform_int_distribution<int> coordinate_distribution(0, 10);
+    std::uniform_int_distribution<unsigned> size_distribution(0, 9);
+
+    // The contribution of a point is the hypervolume it adds to a front,
+    // including ties, dominated points and points outside the box
+    for (unsigned num_objectives : {2, 3, 4}) {
+        const std::vector<NSBRKGA::Sense> senses(num_objectives,
+                                                 NSBRKGA::Sense::MINIMIZE);
+        const std::vector<double> reference_point(num_objectives, 10.0);
+
+        for (unsigned test = 0; test < 500; test++) {
+            std::vector<std::vector<double>> front(size_distribution(rng),
+                    std::vector<double>(num_objectives));
+            std::vector<double> point(num_objectives);
+
+            for (auto & other : front) {
+                for (double & value : other) {
+                    value = coordinate_distribution(rng);
+                }
+            }
+
+            for (double & value : point) {
+                value = coordinate_distribution(rng);
+            }
+
+            const double hypervolume =
+                brute_force_hypervolume(reference_point, front);
+            std::vector<std::vector<double>> extended_front(front);
+
+            extended_front.push_back(point);
+
+            assert(std::fabs(mofjssp::Indicators::hypervolume_contribution(
+                        senses, reference_point, front, point) -
+                    (brute_force_hypervolume(reference_point, extended_front) -
+                     hypervolume)) < 1e-9);
+        }
+    }
+
+    // The maximization objectives are mirrored
+    {
+        const std::vector<NSBRKGA::Sense> senses = {
+            NSBRKGA::Sense::MINIMIZE,
+            NSBRKGA::Sense::MAXIMIZE
+        };
+
+        assert(mofjssp::Indicators::hypervolume_contribution(
+                    senses, {4.0, 0.0}, {{2.0, 2.0}}, {1.0, 3.0}) == 5.0);
+    }
+
+    // A front equal to the reference front is a perfect approximation
+    {
+        const std::vector<NSBRKGA::Sense> senses(4, NSBRKGA::Sense::MINIMIZE);
+        const std::vector<std::vector<double>> front = {
+            {1.0, 4.0, 2.0, 8.0},
+            {2.0, 3.0, 3.0, 7.0},
+            {4.0, 1.0, 5.0, 6.0}
+        };
+
+        assert(mofjssp::Indicators::multiplicative_epsilon(
+                    senses, front, front) == 1.0);
+        assert(mofjssp::Indicators::modified_inverted_generational_distance(
+                    senses, front, front) == 0.0);
+        assert(mofjssp::Indicators::multiplicative_epsilon(
+                    senses, front, {{2.0, 4.0, 5.0, 8.0}}) == 4.0);
+    }
+
+    // The multiplicative epsilon with mixed senses, where the points
+    // are sorted by decreasing first objective
+    {
+        const std::vector<NSBRKGA::Sense> senses = {NSBRKGA::Sense::MAXIMIZE,
+                                                    NSBRKGA::Sense::MINIMIZE};
+
+        assert(mofjssp::Indicators::multiplicative_epsilon(
+                    senses, {{4.0, 2.0}, {8.0, 4.0}},
+                    {{1.0, 2.0}, {2.0, 4.0}}) == 4.0);
+        assert(mofjssp::Indicators::multiplicative_epsilon(
+                    senses, {{4.0, 2.0}}, {}) ==
+               std::numeric_limits<double>::infinity());
+        assert(mofjssp::Indicators::multiplicative_epsilon(
+                    senses, {}, {{1.0, 2.0}}) == 0.0);
+    }
+
+    std::cout << std::endl << "Indicators Test PASSED" << std::endl;
+
+    return 0;
+}
@@ -1,7 +1,9 @@
 #include "instance/instance.hpp"
+#include <algorithm>
 #include <cassert>
 #include <fstream>
 #include <iostream>
+#include <stdexcept>
 
 int main() {
     std::ifstream ifs;
@@ -35,8 +37,62 @@ int main() {
         assert(instance.is_valid());
 
         assert(instance.primal_bound[2] >= 37);
+
+        // The bounds are valid, and the schedule of the heuristic bound
+        // is tighter than the primal bound
+        for (unsigned i = 0; i < instance.num_objectives; i++) {
+            assert(instance.lower_bound[i] > 0.0);
+            assert(instance.lower_bound[i] <= instance.heuristic_bound[i]);
+            assert(instance.heuristic_bound[i] <= instance.primal_bound[i]);
+        }
+
+        assert(instance.heuristic_bound[0] < instance.primal_bound[0]);
+        assert(&instance.reference_point(
+                    mofjssp::Reference_Point::PRIMAL_BOUND) ==
+                &instance.primal_bound);
+        assert(&instance.reference_point(
+                    mofjssp::Reference_Point::HEURISTIC_BOUND) ==
+                &instance.heuristic_bound);
+
+        const auto shared_instance = mofjssp::Instance::load(filename);
+
+        assert(shared_instance == mofjssp::Instance::load(filename));
+        assert(shared_instance->total_num_operations ==
+                instance.total_num_operations);
+        assert(shared_instance->primal_bound == instance.primal_bound);
+
+        // The instance built from the processing times alone must match
+        const mofjssp::Instance instance_of_map(instance.processing_time);
+
+        assert(instance_of_map.is_valid());
+        assert(instance_of_map.num_jobs == instance.num_jobs);
+        // Machines without operations are unknown to the processing times
+        assert(instance_of_map.num_machines <= instance.num_machines);
+        assert(instance_of_map.num_operations == instance.num_operations);
+        assert(instance_of_map.total_num_operations ==
+                instance.total_num_operations);
+        assert(std::equal(instance_of_map.operations_of_machine.begin(),
+                          instance_of_map.operations_of_machine.end(),
+                          instance.operations_of_machine.begin()));
+        assert(instance_of_map.primal_bound == instance.primal_bound);
+        assert(instance_of_map.heuristic_bound == instance.heuristic_bound);
+
+        mofjssp::Instance moved_instance(std::move(
+                    mofjssp::Instance(instance_of_map)));
+
+        assert(moved_instance.processing_time == instance.processing_time);
     }
 
+    assert(mofjssp::parse_reference_point("primal") ==
+           mofjssp::Reference_Point::PRIMAL_BOUND);
+    assert(mofjssp::parse_reference_point("heuristic") ==
+           mofjssp::Reference_Point::HEURISTIC_BOUND);
+
+    try {
+        mofjssp::parse_reference_point("ideal");
+        assert(false);
+    } catch (const std::invalid_argument &) {}
+
     std::cout << std::endl << "Instance Test PASSED" << std::endl;
 
     return 0;
@@ -0,0 +1,104 @@
+#include "solver/local_search.hpp"
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+int main() {
+    std::ifstream ifs;
+    mofjssp::Instance instance;
+    std::mt19937 rng(2351389233);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    for (const std::string filename : {"instances/mk01.txt",
+                                       "instances/mk02.txt",
+                                       "instances/mk03.txt",
+                                       "instances/mk04.txt",
+                                       "instances/mk05.txt",
+                                       "instances/mk06.txt",
+                                       "instances/mk07.txt",
+                                       "instances/mk08.txt",
+                                       "instances/mk09.txt",
+                                       "instances/mk10.txt",
+                                       "instances/mk11.txt",
+                                       "instances/mk12.txt",
+                                       "instances/mk13.txt",
+                                       "instances/mk14.txt",
+                                       "instances/mk15.txt"}) {
+        std::cout << filename << std::endl;
+
+        ifs.open(filename);
+
+        assert(ifs.is_open());
+
+        ifs >> instance;
+
+        ifs.close();
+
+        mofjssp::Local_Search local_search(instance);
+        unsigned num_improved = 0;
+
+        for (unsigned i = 0; i < 10; i++) {
+            std::vector<double> key(2 * instance.total_num_operations);
+
+            for (double & allele : key) {
+                allele = distribution(rng);
+            }
+
+            const mofjssp::Solution solution(instance, key);
+
+            // The critical path starts at time zero, ends at the makespan
+            // and each of its operations starts when the previous one ends
+            const auto path = solution.critical_path();
+
+            assert(!path.empty());
+            assert(solution.starting_time_of_operation[path.front().first]
+                                                      [path.front().second] ==
+                   0.0);
+            assert(solution.ending_time_of_operation[path.back().first]
+                                                    [path.back().second] ==
+                   solution.value[0]);
+
+            for (std::size_t j = 1; j < path.size(); j++) {
+                assert(solution.ending_time_of_operation[path[j - 1].first]
+                                                        [path[j - 1].second] ==
+                       solution.starting_time_of_operation[path[j].first]
+                                                          [path[j].second]);
+            }
+
+            // The key of a solution decodes back to the same schedule
+            const mofjssp::Solution copy(instance, solution.key());
+
+            assert(copy.value == solution.value);
+            assert(copy.machine_of_operation == solution.machine_of_operation);
+            assert(copy.starting_time_of_operation ==
+                   solution.starting_time_of_operation);
+
+            // The improved solution dominates the original one, and its key
+            // decodes to its value
+            const std::vector<double> original_value(solution.value.begin(),
+                                                     solution.value.end());
+            std::vector<double> value = original_value;
+
+            if (local_search.improve(key, value)) {
+                const mofjssp::Solution improved_solution(instance, key);
+
+                assert(mofjssp::Solution::dominates(value, original_value));
+                assert(std::equal(value.begin(), value.end(),
+                                  improved_solution.value.begin()));
+                assert(improved_solution.is_feasible());
+                num_improved++;
+            } else {
+                assert(value == original_value);
+            }
+        }
+
+        assert(num_improved > 0);
+        assert(local_search.num_improvements >= num_improved);
+    }
+
+    std::cout << std::endl << "Local Search Test PASSED" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include "solver/non_dominated_sort.hpp"
+#include <cassert>
+#include <iostream>
+#include <random>
+
+int main() {
+    std::mt19937 rng(2351389233);
+
+    for (unsigned num_objectives : {2, 3, 4}) {
+        for (unsigned size : {0, 1, 10, 100, 500}) {
+            std::vector<NSBRKGA::Sense> senses(num_objectives,
+                                               NSBRKGA::Sense::MINIMIZE);
+            std::uniform_int_distribution<int> distribution(0, 20);
+            std::vector<std::pair<std::vector<double>, unsigned>> individuals;
+
+            senses.back() = NSBRKGA::Sense::MAXIMIZE;
+
+            // Small integer values, so that there are many ties
+            for (unsigned i = 0; i < size; i++) {
+                std::vector<double> value(num_objectives);
+
+                for (double & v : value) {
+                    v = distribution(rng);
+                }
+
+                individuals.push_back(std::make_pair(value, i));
+            }
+
+            auto dominates = [&senses](const std::vector<double> & a,
+                                       const std::vector<double> & b) {
+                bool at_least_as_good = true, better = false;
+
+                for (std::size_t k = 0; k < a.size(); k++) {
+                    const double x = senses[k] == NSBRKGA::Sense::MAXIMIZE ?
+                                     -a[k] : a[k],
+                                 y = senses[k] == NSBRKGA::Sense::MAXIMIZE ?
+                                     -b[k] : b[k];
+
+                    at_least_as_good = at_least_as_good && x <= y;
+                    better = better || x < y;
+                }
+
+                return at_least_as_good && better;
+            };
+
+            // The rank of each individual by peeling off the fronts
+            std::vector<unsigned> rank(size, size);
+
+            for (unsigned r = 0, num_ranked = 0; num_ranked < size; r++) {
+                std::vector<unsigned> front;
+
+                for (unsigned i = 0; i < size; i++) {
+                    if (rank[i] < r) {
+                        continue;
+                    }
+
+                    bool is_dominated = false;
+
+                    for (unsigned j = 0; j < size && !is_dominated; j++) {
+                        is_dominated = rank[j] >= r &&
+                            dominates(individuals[j].first,
+                                      individuals[i].first);
+                    }
+
+                    if (!is_dominated) {
+                        front.push_back(i);
+                    }
+                }
+
+                for (const unsigned & i : front) {
+                    rank[i] = r;
+                    num_ranked++;
+                }
+            }
+
+            const auto fronts = mofjssp::Non_Dominated_Sort::sort(individuals,
+                                                                  senses);
+            unsigned num_sorted = 0;
+
+            for (std::size_t r = 0; r < fronts.size(); r++) {
+                assert(!fronts[r].empty());
+
+                for (std::size_t i = 0; i < fronts[r].size(); i++) {
+                    assert(rank[fronts[r][i].second] == r);
+                    assert(i == 0 ||
+                           fronts[r][i - 1].second < fronts[r][i].second);
+                    num_sorted++;
+                }
+            }
+
+            assert(num_sorted == size);
+
+            const auto first_front =
+                mofjssp::Non_Dominated_Sort::first_front(individuals, senses);
+
+            assert(first_front.size() == (fronts.empty() ? 0 :
+                                          fronts.front().size()));
+        }
+    }
+
+    std::cout << "Non-Dominated Sort Test PASSED" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+#include "solver/objective_space.hpp"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+
+// The multiplicative epsilon by comparing every pair of points
+static double exhaustive_multiplicative_epsilon(
+        const std::vector<NSBRKGA::Sense> & senses,
+        const std::vector<std::vector<double>> & reference_front,
+        const std::vector<std::vector<double>> & front) {
+    double epsilon = 0.0;
+
+    for (const auto & reference : reference_front) {
+        double min_max_ratio = std::numeric_limits<double>::infinity();
+
+        for (const auto & point : front) {
+            double max_ratio = 0.0;
+
+            for (unsigned k = 0; k < senses.size(); k++) {
+                max_ratio = std::max(max_ratio,
+                        senses[k] == NSBRKGA::Sense::MINIMIZE ?
+                            point[k] / reference[k] : reference[k] / point[k]);
+            }
+
+            min_max_ratio = std::min(min_max_ratio, max_ratio);
+        }
+
+        epsilon = std::max(epsilon, min_max_ratio);
+    }
+
+    return epsilon;
+}
+
+// The IGD+ by comparing every pair of points
+static double exhaustive_igd_plus(
+        const std::vector<NSBRKGA::Sense> & senses,
+        const std::vector<std::vector<double>> & reference_front,
+        const std::vector<std::vector<double>> & front) {
+    double igd_plus = 0.0;
+
+    for (const auto & reference : reference_front) {
+        double min_distance = std::numeric_limits<double>::infinity();
+
+        for (const auto & point : front) {
+            min_distance = std::min(min_distance,
+                    mofjssp::Indicators::modified_distance(senses,
+                                                           reference,
+                                                           point));
+        }
+
+        igd_plus += min_distance;
+    }
+
+    return igd_plus / reference_front.size();
+}
+
+int main() {
+    const std::vector<NSBRKGA::Sense> senses = {NSBRKGA::Sense::MINIMIZE,
+                                                NSBRKGA::Sense::MAXIMIZE,
+                                                NSBRKGA::Sense::MINIMIZE,
+                                                NSBRKGA::Sense::MINIMIZE};
+    const std::vector<double> reference_point = {100.0, 0.5, 100.0, 100.0};
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> distribution(1.0, 90.0);
+    const auto random_front = [&](unsigned size) {
+        std::vector<std::vector<double>> front(size, std::vector<double>(4));
+
+        for (auto & point : front) {
+            for (double & value : point) {
+                value = distribution(rng);
+            }
+        }
+
+        return front;
+    };
+    const auto reference_front = random_front(50);
+    const mofjssp::Objective_Space objective_space(senses,
+                                                   reference_point,
+                                                   reference_front);
+
+    assert(objective_space.reference_hypervolume ==
+           mofjssp::Indicators::hypervolume(senses, reference_point,
+                                            reference_front));
+    assert(objective_space.reference_igd_plus ==
+           exhaustive_igd_plus(senses, reference_front, {reference_point}));
+
+    // The pruned searches find the same values as the exhaustive ones
+    for (unsigned size : {1, 2, 10, 100}) {
+        const auto values = random_front(size);
+        const auto front = objective_space.front(values);
+
+        assert(objective_space.multiplicative_epsilon(front) ==
+               exhaustive_multiplicative_epsilon(senses, reference_front,
+                                                 values));
+        assert(objective_space.normalized_modified_inverted_generational_distance(
+                    front) ==
+               exhaustive_igd_plus(senses, reference_front, values) /
+                   objective_space.reference_igd_plus);
+        assert(std::fabs(objective_space.hypervolume_ratio(front) -
+                         mofjssp::Indicators::hypervolume(senses,
+                                                          reference_point,
+                                                          values) /
+                             objective_space.reference_hypervolume) <= 1e-12);
+    }
+
+    // A front read is sorted by its first objective, with the
+    // maximization objectives negated
+    std::istringstream iss("3 1 2 2\n1 2 3 3\n2 4 1 1\n");
+    const auto front = objective_space.read_front(iss);
+
+    assert((front.points == std::vector<double>{1, -2, 3, 3,
+                                                2, -4, 1, 1,
+                                                3, -1, 2, 2}));
+
+    // A reference point is widened past the nadir point of a front it
+    // does not bound, and kept if it bounds it
+    assert((mofjssp::Objective_Space::bounding_reference_point(
+                    senses, {2, 3, 2, 0}, {{3, 1, 2, 2}, {1, 2, 3, 3},
+                                           {2, 4, 1, 1}}) ==
+            std::vector<double>{4, 0, 4, 4}));
+    assert(mofjssp::Objective_Space::bounding_reference_point(
+                senses, reference_point, reference_front) == reference_point);
+
+    std::cout << std::endl << "Objective Space Test PASSED" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include "solver/nsbrkga/decoder.hpp"
+#include "solver/population_matrix.hpp"
+#include <cassert>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+int main() {
+    std::mt19937 rng(2351389233);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    // The rows are aligned, and survive the reallocations
+    for (std::size_t key_size : {0, 1, 7, 8, 9, 480}) {
+        mofjssp::Population_Matrix matrix(4, key_size);
+        std::vector<std::pair<std::vector<double>, std::vector<double>>>
+            individuals;
+
+        for (unsigned i = 0; i < 300; i++) {
+            std::vector<double> value(4), key(key_size);
+
+            for (double & v : value) {
+                v = distribution(rng);
+            }
+
+            for (double & allele : key) {
+                allele = distribution(rng);
+            }
+
+            individuals.push_back(std::make_pair(value, key));
+            matrix.push_back(value, key);
+        }
+
+        assert(matrix.size() == individuals.size());
+        assert(matrix.individuals() == individuals);
+
+        for (std::size_t i = 0; i < matrix.size(); i++) {
+            assert(reinterpret_cast<std::uintptr_t>(matrix.value(i).data()) %
+                   mofjssp::Population_Matrix::alignment == 0);
+        }
+
+        const mofjssp::Population_Matrix copy = matrix;
+        std::size_t i = 0;
+
+        for (const auto & value : copy) {
+            assert(value.vector() == individuals[i++].first);
+        }
+
+        assert(i == individuals.size());
+
+        // A moved matrix is left empty, and can be written again
+        mofjssp::Population_Matrix moved = std::move(matrix);
+
+        assert(moved.individuals() == individuals);
+        assert(matrix.empty());
+
+        matrix.push_back(individuals.front().first,
+                         individuals.front().second);
+
+        assert(matrix.size() == 1);
+        assert(matrix.key(0) == individuals.front().second);
+
+        matrix = std::move(moved);
+
+        assert(matrix.individuals() == individuals);
+        assert(moved.empty());
+
+        moved.resize(2);
+
+        assert(moved.size() == 2);
+
+        matrix.clear();
+
+        assert(matrix.empty());
+        assert(copy.individuals() == individuals);
+    }
+
+    // Decoding a population matrix agrees with decoding each chromosome
+    std::ifstream ifs;
+    mofjssp::Instance instance;
+
+    for (const std::string filename : {"instances/mk01.txt",
+                                       "instances/mk08.txt",
+                                       "instances/mk15.txt"}) {
+        std::cout << filename << std::endl;
+
+        ifs.open(filename);
+
+        assert(ifs.is_open());
+
+        ifs >> instance;
+
+        ifs.close();
+
+        mofjssp::Decoder decoder(instance, 1), population_decoder(instance, 1);
+        mofjssp::Population_Matrix population(
+                instance.num_objectives, 2 * instance.total_num_operations);
+        std::vector<NSBRKGA::Chromosome> chromosomes(
+                100, NSBRKGA::Chromosome(2 * instance.total_num_operations));
+
+        for (auto & chromosome : chromosomes) {
+            for (double & allele : chromosome) {
+                allele = distribution(rng);
+            }
+
+            population.push_back(
+                    std::vector<double>(instance.num_objectives, 0.0),
+                    chromosome);
+        }
+
+        population_decoder.decode(population);
+
+        for (std::size_t i = 0; i < chromosomes.size(); i++) {
+            assert(decoder.decode(chromosomes[i], false) ==
+                   population.value(i).vector());
+        }
+    }
+
+    std::cout << std::endl << "Population Matrix Test PASSED" << std::endl;
+
+    return 0;
+}
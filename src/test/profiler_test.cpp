@@ -0,0 +1,79 @@
+#include "utils/profiler.hpp"
+#include <cassert>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+int main() {
+    const auto start = std::chrono::steady_clock::now();
+
+    // The intervals of every thread are summed, including those of the
+    // threads that already ended
+    std::vector<std::thread> threads;
+
+    for (unsigned i = 0; i < 4; i++) {
+        threads.emplace_back([start]() {
+            for (unsigned j = 1; j <= 100; j++) {
+                Profiler::record(Profiled_Phase::DECODE,
+                                 start,
+                                 start + std::chrono::microseconds(j));
+            }
+
+            Profiler::record(Profiled_Phase::SHAKE,
+                             start,
+                             start + std::chrono::milliseconds(1));
+        });
+    }
+
+    for (std::thread & thread : threads) {
+        thread.join();
+    }
+
+    auto statistics = Profiler::statistics();
+
+    assert(statistics[unsigned(Profiled_Phase::DECODE)].num_intervals == 400);
+    assert(statistics[unsigned(Profiled_Phase::DECODE)].time ==
+           std::chrono::microseconds(4 * 5050));
+    assert(statistics[unsigned(Profiled_Phase::SHAKE)].num_intervals == 4);
+    assert(statistics[unsigned(Profiled_Phase::EVOLVE)].num_intervals == 0);
+
+    std::ostringstream statistics_stream;
+
+    Profiler::write_statistics(statistics_stream);
+
+    assert(statistics_stream.str().find("Time in decode: 0.0202") !=
+           std::string::npos);
+    assert(statistics_stream.str().find("evolve") == std::string::npos);
+
+    // One complete event per interval
+    std::ostringstream trace;
+    std::size_t num_events = 0;
+
+    Profiler::write_trace(trace);
+
+    for (std::size_t i = trace.str().find("\"ph\":\"X\"");
+         i != std::string::npos;
+         i = trace.str().find("\"ph\":\"X\"", i + 1)) {
+        num_events++;
+    }
+
+    assert(num_events == 404);
+    assert(trace.str().rfind("{\"traceEvents\":[", 0) == 0);
+
+    Profiler::reset();
+    statistics = Profiler::statistics();
+
+    assert(statistics[unsigned(Profiled_Phase::DECODE)].num_intervals == 0);
+
+    // The scoped timers measure only if profiling is compiled in
+    {
+        MOFJSSP_PROFILE_SCOPE(EVOLVE);
+    }
+
+    assert(Profiler::statistics()[unsigned(Profiled_Phase::EVOLVE)]
+                .num_intervals == (Profiler::enabled() ? 1 : 0));
+
+    std::cout << std::endl << "Profiler Test PASSED" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include "utils/results_store.hpp"
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <thread>
+
+int main() {
+    const std::string filename = "results_store_test.csv";
+    const Results_Store::Row run = {
+        "mk01", "nsga2", 0, Results_Store::FINAL_SNAPSHOT, 0, 0.0,
+        10, 6, 55, 4, {}
+    };
+
+    std::remove(filename.c_str());
+
+    // Each calculator appends the rows of its metric, in parallel
+    std::vector<std::thread> threads;
+
+    for (unsigned metric = 0; metric < Results_Store::NUM_METRICS; metric++) {
+        threads.emplace_back([&filename, &run, metric]() {
+            for (unsigned seed = 0; seed < 50; seed++) {
+                Results_Store::Row seed_run(run);
+
+                seed_run.seed = seed;
+
+                Results_Store::append(filename, Results_Store::run_rows(
+                            seed_run,
+                            Results_Store::Metric(metric),
+                            metric + seed / 100.0,
+                            {10, 20},
+                            {1.5, 3.0},
+                            {0.1 * metric, 0.2 * metric}));
+            }
+        });
+    }
+
+    for (std::thread & thread : threads) {
+        thread.join();
+    }
+
+    // The rows of the same run and snapshot are merged
+    const Results_Store store = Results_Store::load(filename);
+
+    assert(store.size() == 50 * 3);
+
+    for (std::size_t i = 0; i < store.size(); i++) {
+        const Results_Store::Row row = store.row(i);
+
+        assert(row.instance == "mk01");
+        assert(row.solver == "nsga2");
+        assert(row.num_operations == 55);
+
+        for (unsigned metric = 0;
+             metric < Results_Store::NUM_METRICS;
+             metric++) {
+            if (row.snapshot == Results_Store::FINAL_SNAPSHOT) {
+                assert(row.iteration == 0);
+                assert(row.metrics[metric] == metric + row.seed / 100.0);
+            } else {
+                assert(row.iteration == 10u * (row.snapshot + 1));
+                assert(row.time == 1.5 * (row.snapshot + 1));
+                assert(std::fabs(row.metrics[metric] -
+                                 0.1 * metric * (row.snapshot + 1)) < 1e-12);
+            }
+        }
+    }
+
+    assert(Results_Store::is_maximized(Results_Store::HYPERVOLUME));
+    assert(!Results_Store::is_maximized(Results_Store::IGD_PLUS));
+
+    std::remove(filename.c_str());
+
+    std::cout << std::endl << "Results Store Test PASSED" << std::endl;
+
+    return 0;
+}
@@ -41,9 +41,75 @@ int main() {
 
         assert(solution.is_feasible());
 
+        // The active schedule of a key completes each job no later than
+        // its semi-active schedule, with the same machine workloads
+        mofjssp::Solution active_solution(instance, key, true);
+
+        assert(active_solution.is_feasible());
+        assert(active_solution.value[0] <= solution.value[0]);
+        assert(active_solution.value[1] <= solution.value[1]);
+        assert(active_solution.value[2] == solution.value[2]);
+        assert(active_solution.value[3] == solution.value[3]);
+
+        // The schedules of a pool fit in its buffers, since the pool
+        // can not fall back to the (null) default resource
+        std::pmr::memory_resource * resource =
+            std::pmr::set_default_resource(std::pmr::null_memory_resource());
+        const auto pool = std::make_shared<mofjssp::Solution_Pool>(instance,
+                                                                   2, 2);
+
+        std::pmr::set_default_resource(resource);
+
+        for (unsigned arena = 0; arena < pool->num_arenas(); arena++) {
+            for (bool active : {false, true}) {
+                mofjssp::Solution pool_solution(instance, key, active, pool,
+                                                arena);
+                const mofjssp::Solution & other_solution =
+                    active ? active_solution : solution;
+
+                assert(pool_solution.is_feasible());
+                assert(pool_solution.value == other_solution.value);
+                assert(pool_solution.machine_of_operation ==
+                       other_solution.machine_of_operation);
+                assert(pool_solution.starting_time_of_operation ==
+                       other_solution.starting_time_of_operation);
+
+                const mofjssp::Solution copy = pool_solution;
+
+                assert(copy.pool == nullptr);
+                assert(copy.machine_of_operation.get_allocator().resource() ==
+                       std::pmr::get_default_resource());
+                assert(copy.operations_of_machine ==
+                       pool_solution.operations_of_machine);
+            }
+        }
+
         std::cout << solution << std::endl;
     }
 
+    // The dominance kernel agrees with the element-wise definition,
+    // including on ties
+    std::uniform_int_distribution<int> objective_distribution(0, 2);
+
+    for (unsigned i = 0; i < 10000; i++) {
+        mofjssp::Objectives<> valueA, valueB;
+        bool at_least_as_good = true, better = false;
+
+        for (unsigned j = 0; j < valueA.size(); j++) {
+            valueA[j] = objective_distribution(rng);
+            valueB[j] = objective_distribution(rng);
+            at_least_as_good = at_least_as_good && valueA[j] <= valueB[j];
+            better = better || valueA[j] < valueB[j];
+        }
+
+        assert(mofjssp::Solution::dominates(valueA, valueB) ==
+               (at_least_as_good && better));
+        assert(mofjssp::Solution::dominates(
+                    std::vector<double>(valueA.begin(), valueA.end()),
+                    std::vector<double>(valueB.begin(), valueB.end())) ==
+               (at_least_as_good && better));
+    }
+
     std::cout << std::endl << "Solution Test PASSED" << std::endl;
 
     return 0;
@@ -0,0 +1,90 @@
+#include "utils/thread_pool.hpp"
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+
+int main() {
+    const unsigned num_threads = 4;
+
+    // A worker starts the tasks of its queue in the order they were
+    // submitted, e.g., the longest first if so sorted
+    {
+        std::vector<unsigned> started;
+        Thread_Pool pool(1);
+
+        for (unsigned i = 0; i < 16; i++) {
+            pool.submit([&started, i]() {
+                started.push_back(i);
+            });
+        }
+
+        pool.wait();
+
+        for (unsigned i = 0; i < started.size(); i++) {
+            assert(started[i] == i);
+        }
+
+        assert(started.size() == 16);
+    }
+
+    // The threads of the running tasks never exceed those of the pool
+    {
+        std::atomic<unsigned> num_busy_threads(0), max_num_busy_threads(0);
+        Thread_Pool pool(num_threads);
+
+        for (unsigned i = 0; i < 40; i++) {
+            const unsigned task_num_threads = 1 + i % 3;
+
+            pool.submit([&, task_num_threads]() {
+                const unsigned busy = num_busy_threads += task_num_threads;
+                unsigned max_busy = max_num_busy_threads;
+
+                while (busy > max_busy &&
+                       !max_num_busy_threads.compare_exchange_weak(max_busy,
+                                                                   busy)) {}
+
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                num_busy_threads -= task_num_threads;
+            }, task_num_threads);
+        }
+
+        pool.wait();
+
+        assert(max_num_busy_threads <= num_threads);
+        assert(max_num_busy_threads >= 2);
+    }
+
+    // A task with more threads than the pool runs alone
+    {
+        std::atomic<unsigned> num_finished(0);
+        Thread_Pool pool(2);
+
+        pool.submit([&]() { num_finished++; }, 8);
+        pool.submit([&]() { num_finished++; });
+        pool.wait();
+
+        assert(num_finished == 2);
+    }
+
+    // The first exception is rethrown by wait
+    {
+        Thread_Pool pool(num_threads);
+        bool thrown = false;
+
+        pool.submit([]() { throw std::runtime_error("task failed"); });
+
+        try {
+            pool.wait();
+        } catch (const std::runtime_error &) {
+            thrown = true;
+        }
+
+        assert(thrown);
+    }
+
+    std::cout << std::endl << "Thread Pool Test PASSED" << std::endl;
+
+    return 0;
+}
@@ -1,23 +1,146 @@
 #include "utils/argument_parser.hpp"
-#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
 
 Argument_Parser::Argument_Parser(int argc, char * argv[]) {
     for (int i = 1; i < argc; i++) {
-        this->tokens.push_back(std::string(argv[i]));
+        this->add_token(std::string(argv[i]));
     }
+
+    std::vector<std::string> * values = nullptr;
+
+    for (const std::string & token : this->tokens) {
+        if (token.compare(0, 2, "--") == 0) {
+            values = &this->options[token];
+        } else if (values != nullptr) {
+            values->push_back(token);
+        }
+    }
+
+    std::size_t num_runs = 0;
+
+    for (const std::string & filename : this->option_values("--runs")) {
+        num_runs += this->add_runs(filename, num_runs);
+    }
+
+    // The indexed options of the lists, which are only added after all
+    // the options so that those given are kept
+    std::vector<std::pair<std::string, std::string>> indexed_options;
+
+    for (const auto & option : this->options) {
+        for (std::size_t j = 0; j < option.second.size(); j++) {
+            indexed_options.emplace_back(option.first + "-" + std::to_string(j),
+                                         option.second[j]);
+        }
+    }
+
+    for (const auto & indexed_option : indexed_options) {
+        this->options.emplace(indexed_option.first,
+                              std::vector<std::string>(
+                                  1, indexed_option.second));
+    }
+}
+
+void Argument_Parser::add_token(const std::string & token) {
+    if (token.empty() || token[0] != '@') {
+        this->tokens.push_back(token);
+        return;
+    }
+
+    std::ifstream ifs;
+
+    ifs.open(token.substr(1));
+
+    if (!ifs.is_open()) {
+        throw std::runtime_error("File " + token.substr(1) + " not found.");
+    }
+
+    for (std::string file_token; ifs >> file_token;) {
+        this->add_token(file_token);
+    }
+
+    if (ifs.bad()) {
+        throw std::runtime_error("Error reading file " + token.substr(1) +
+                                 ".");
+    }
+
+    ifs.close();
+}
+
+std::size_t Argument_Parser::add_runs(const std::string & filename,
+                                      std::size_t first_run) {
+    std::ifstream ifs;
+    std::vector<std::string> columns;
+    std::size_t num_runs = 0;
+
+    ifs.open(filename);
+
+    if (!ifs.is_open()) {
+        throw std::runtime_error("File " + filename + " not found.");
+    }
+
+    for (std::string line; std::getline(ifs, line);) {
+        std::vector<std::string> fields;
+        std::istringstream iss(line);
+
+        if (line.empty()) {
+            continue;
+        }
+
+        for (std::string field; std::getline(iss, field, ',');) {
+            fields.push_back(field);
+        }
+
+        // A trailing comma ends with an empty field
+        if (line.back() == ',') {
+            fields.emplace_back();
+        }
+
+        if (columns.empty()) {
+            columns.swap(fields);
+            continue;
+        }
+
+        if (fields.size() != columns.size()) {
+            throw std::runtime_error("Error reading file " + filename + ".");
+        }
+
+        for (std::size_t j = 0; j < columns.size(); j++) {
+            if (!fields[j].empty()) {
+                this->options.emplace(
+                        "--" + columns[j] + "-" +
+                            std::to_string(first_run + num_runs),
+                        std::vector<std::string>(1, fields[j]));
+            }
+        }
+
+        num_runs++;
+    }
+
+    ifs.close();
+
+    return num_runs;
 }
 
 std::string Argument_Parser::option_value(const std::string & option) const {
-    auto it = std::find(this->tokens.begin(), this->tokens.end(), option);
+    auto it = this->options.find(option);
 
-    if (it != this->tokens.end() && ++it != this->tokens.end()) {
-        return *it;
+    if (it != this->options.end() && !it->second.empty()) {
+        return it->second.front();
     }
 
     return std::string("");
 }
 
+const std::vector<std::string> & Argument_Parser::option_values(
+        const std::string & option) const {
+    static const std::vector<std::string> no_values;
+    auto it = this->options.find(option);
+
+    return it != this->options.end() ? it->second : no_values;
+}
+
 bool Argument_Parser::option_exists(const std::string & option) const {
-    return std::find(this->tokens.begin(), this->tokens.end(), option) !=
-        this->tokens.end();
+    return this->options.count(option) > 0;
 }
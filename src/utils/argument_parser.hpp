@@ -1,8 +1,22 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+/*********************************************************************
+ * The Argument_Parser class parses the options of the command line,
+ * i.e., the tokens starting with "--", each followed by its values up
+ * to the next option. An option may be repeated or given a list of
+ * values, e.g., "--pareto a b c", the j-th value also being the value
+ * of the indexed option "--pareto-j" unless it is given. A token
+ * "@file" is replaced by the whitespace separated tokens of the file.
+ * The option "--runs" lists CSV files of runs, whose header names
+ * options, e.g., "solver,seed,pareto"; the i-th run, counted over the
+ * files, gives the values of the indexed options "--solver-i",
+ * "--seed-i" and "--pareto-i", unless they are given, its empty
+ * fields being skipped.
+ *********************************************************************/
 class Argument_Parser {
 public:
     /********************************
@@ -10,11 +24,43 @@ public:
      ********************************/
     std::vector<std::string> tokens;
 
+private:
+    /********************************
+     * The values of each option.
+     ********************************/
+    std::unordered_map<std::string, std::vector<std::string>> options;
+
+    /*****************************************************************
+     * Appends a token, or the tokens of its file if it is "@file".
+     *
+     * @param token the token.
+     *
+     * @throw std::runtime_error if the file cannot be read.
+     *****************************************************************/
+    void add_token(const std::string & token);
+
+    /*****************************************************************
+     * Adds the indexed options of the runs of a runs file.
+     *
+     * @param filename  the name of the runs file.
+     * @param first_run the index of its first run.
+     *
+     * @return the number of runs of the file.
+     *
+     * @throw std::runtime_error if the file cannot be read.
+     *****************************************************************/
+    std::size_t add_runs(const std::string & filename,
+                         std::size_t first_run);
+
+public:
     /*****************************************
      * Constructs a new argument parser.
      *
      * @param argc the number of arguments.
      * @param argv the array of arguments.
+     *
+     * @throw std::runtime_error if a file of
+     *        tokens or runs cannot be read.
      *****************************************/
     Argument_Parser(int argc, char * argv[]);
 
@@ -23,10 +69,21 @@ public:
      *
      * @param the option whose value is to be returned.
      *
-     * @return the value of the specified option.
+     * @return the first value of the specified option, or an
+     *         empty string if it has none.
      ***********************************************************/
     std::string option_value(const std::string & option) const;
 
+    /***********************************************************
+     * Returns the values of the specified option.
+     *
+     * @param the option whose values are to be returned.
+     *
+     * @return the values of the specified option.
+     ***********************************************************/
+    const std::vector<std::string> & option_values(
+            const std::string & option) const;
+
     /****************************************************************
      * Verifies whether the specified option exists.
      *
@@ -0,0 +1,132 @@
+#include "utils/performance_counters.hpp"
+
+#if defined(__linux__) && __has_include(<linux/perf_event.h>)
+#   define PERFORMANCE_COUNTERS_AVAILABLE
+#   include <linux/perf_event.h>
+#   include <sys/ioctl.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#   include <cstring>
+#endif
+
+Performance_Counters::Performance_Counters() {
+    this->file_descriptors.fill(-1);
+    this->counts.fill(-1.0);
+
+#   ifdef PERFORMANCE_COUNTERS_AVAILABLE
+    static const std::array<std::uint64_t, NUM_EVENTS> configs = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_REFERENCES,
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_INSTRUCTIONS,
+        PERF_COUNT_HW_BRANCH_MISSES
+    };
+
+    for (unsigned event = 0; event < NUM_EVENTS; event++) {
+        perf_event_attr attr;
+
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = configs[event];
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED |
+                           PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        // The calling thread, on any processor
+        this->file_descriptors[event] =
+            syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    }
+#   endif
+}
+
+Performance_Counters::~Performance_Counters() {
+#   ifdef PERFORMANCE_COUNTERS_AVAILABLE
+    for (int file_descriptor : this->file_descriptors) {
+        if (file_descriptor >= 0) {
+            close(file_descriptor);
+        }
+    }
+#   endif
+}
+
+std::string Performance_Counters::name(Event event) {
+    switch (event) {
+        case CYCLES:
+            return "cycles";
+        case INSTRUCTIONS:
+            return "instructions";
+        case CACHE_REFERENCES:
+            return "cache_references";
+        case CACHE_MISSES:
+            return "cache_misses";
+        case BRANCHES:
+            return "branches";
+        case BRANCH_MISSES:
+            return "branch_misses";
+        default:
+            return "unknown";
+    }
+}
+
+bool Performance_Counters::is_available(Event event) const {
+    return this->file_descriptors[event] >= 0;
+}
+
+bool Performance_Counters::is_available() const {
+    for (unsigned event = 0; event < NUM_EVENTS; event++) {
+        if (this->is_available(Event(event))) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void Performance_Counters::start() {
+#   ifdef PERFORMANCE_COUNTERS_AVAILABLE
+    for (int file_descriptor : this->file_descriptors) {
+        if (file_descriptor >= 0) {
+            ioctl(file_descriptor, PERF_EVENT_IOC_RESET, 0);
+            ioctl(file_descriptor, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#   endif
+}
+
+void Performance_Counters::stop() {
+    this->counts.fill(-1.0);
+
+#   ifdef PERFORMANCE_COUNTERS_AVAILABLE
+    for (int file_descriptor : this->file_descriptors) {
+        if (file_descriptor >= 0) {
+            ioctl(file_descriptor, PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+
+    for (unsigned event = 0; event < NUM_EVENTS; event++) {
+        // The count, and the times the event was enabled and counted
+        std::uint64_t values[3];
+
+        if (this->file_descriptors[event] < 0 ||
+                read(this->file_descriptors[event], values, sizeof(values)) !=
+                    sizeof(values)) {
+            continue;
+        }
+
+        if (values[2] > 0) {
+            this->counts[event] = double(values[0]) * double(values[1]) /
+                                  double(values[2]);
+        } else {
+            this->counts[event] = 0.0;
+        }
+    }
+#   endif
+}
+
+double Performance_Counters::count(Event event) const {
+    return this->counts[event];
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+/*********************************************************************
+ * The Performance_Counters class counts hardware events of the
+ * calling thread between start and stop, with perf_event_open. The
+ * counters are only available on Linux, and only if the kernel allows
+ * it (see /proc/sys/kernel/perf_event_paranoid); otherwise, or for an
+ * event the processor does not count, the count is unavailable and
+ * the measure is not disturbed.
+ *********************************************************************/
+class Performance_Counters {
+    public:
+    /*************************************
+     * The events counted.
+     *************************************/
+    enum Event : unsigned {
+        CYCLES,
+        INSTRUCTIONS,
+        CACHE_REFERENCES,
+        CACHE_MISSES,
+        BRANCHES,
+        BRANCH_MISSES,
+        NUM_EVENTS
+    };
+
+    private:
+    /************************************************
+     * The file descriptor of each event (-1 if the
+     * event is not counted).
+     ************************************************/
+    std::array<int, NUM_EVENTS> file_descriptors;
+
+    /*********************************************
+     * The counts of the last measure, or -1 if
+     * unavailable.
+     *********************************************/
+    std::array<double, NUM_EVENTS> counts;
+
+    public:
+    /*******************************************
+     * Opens the counters of the calling thread.
+     *******************************************/
+    Performance_Counters();
+
+    Performance_Counters(const Performance_Counters & counters) = delete;
+
+    Performance_Counters & operator = (
+            const Performance_Counters & counters) = delete;
+
+    /****************************
+     * Closes the counters.
+     ****************************/
+    ~Performance_Counters();
+
+    /*******************************************
+     * Returns the name of an event.
+     *
+     * @param event the event.
+     *
+     * @return the name of the event.
+     *******************************************/
+    static std::string name(Event event);
+
+    /*****************************************************
+     * Returns whether an event is counted.
+     *
+     * @param event the event.
+     *
+     * @return true if the event is counted; false otherwise.
+     *****************************************************/
+    bool is_available(Event event) const;
+
+    /***********************************************
+     * Returns whether any event is counted.
+     *
+     * @return true if any event is counted; false
+     *         otherwise.
+     ***********************************************/
+    bool is_available() const;
+
+    /*********************************************
+     * Resets and starts counting the events.
+     *********************************************/
+    void start();
+
+    /***********************************************************
+     * Stops counting the events and reads their counts, scaled
+     * up if the kernel multiplexed the counters.
+     ***********************************************************/
+    void stop();
+
+    /*********************************************************
+     * Returns the count of an event in the last measure.
+     *
+     * @param event the event.
+     *
+     * @return the count of the event, or -1 if unavailable.
+     *********************************************************/
+    double count(Event event) const;
+};
@@ -0,0 +1,147 @@
+#include "utils/profiler.hpp"
+#include <iomanip>
+
+const char * to_string(Profiled_Phase phase) {
+    switch (phase) {
+        case Profiled_Phase::DECODE:
+            return "decode";
+        case Profiled_Phase::ARCHIVE_UPDATE:
+            return "archive update";
+        case Profiled_Phase::SNAPSHOT:
+            return "snapshot";
+        case Profiled_Phase::EVOLVE:
+            return "evolve";
+        case Profiled_Phase::EXCHANGE_ELITE:
+            return "exchange elite";
+        case Profiled_Phase::PATH_RELINK:
+            return "path relink";
+        case Profiled_Phase::SHAKE:
+            return "shake";
+        case Profiled_Phase::RESET:
+            return "reset";
+        case Profiled_Phase::LOCAL_SEARCH:
+            return "local search";
+        case Profiled_Phase::MATERIALIZATION:
+            return "materialization";
+        default:
+            return "unknown";
+    }
+}
+
+std::mutex Profiler::records_mutex;
+
+std::vector<std::shared_ptr<Profiler::Thread_Record>> Profiler::records;
+
+const std::chrono::steady_clock::time_point Profiler::epoch =
+    std::chrono::steady_clock::now();
+
+Profiler::Thread_Record & Profiler::record_of_thread() {
+    // The record is shared with the list of records, so that it is
+    // still reported after the thread ends
+    thread_local const std::shared_ptr<Thread_Record> record = []() {
+        auto record = std::make_shared<Thread_Record>();
+        std::lock_guard<std::mutex> lock(Profiler::records_mutex);
+
+        record->thread = Profiler::records.size();
+        Profiler::records.push_back(record);
+
+        return record;
+    }();
+
+    return *record;
+}
+
+void Profiler::record(Profiled_Phase phase,
+                      const std::chrono::steady_clock::time_point & start,
+                      const std::chrono::steady_clock::time_point & end) {
+    Thread_Record & record = Profiler::record_of_thread();
+    const auto duration =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+
+    // Uncontended, except while the records are reported or reset
+    std::lock_guard<std::mutex> lock(record.mutex);
+    Phase_Statistics & statistics = record.statistics[unsigned(phase)];
+
+    statistics.time += duration;
+    statistics.num_intervals++;
+
+    if (record.events.size() < Profiler::max_num_events_of_thread) {
+        record.events.push_back(Event{
+                phase,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    start - Profiler::epoch).count(),
+                duration.count()});
+    }
+}
+
+void Profiler::reset() {
+    std::lock_guard<std::mutex> lock(Profiler::records_mutex);
+
+    for (const auto & record : Profiler::records) {
+        std::lock_guard<std::mutex> record_lock(record->mutex);
+
+        record->statistics.fill(Phase_Statistics());
+        record->events.clear();
+    }
+}
+
+std::array<Profiler::Phase_Statistics, unsigned(Profiled_Phase::NUM_PHASES)>
+        Profiler::statistics() {
+    std::array<Phase_Statistics, unsigned(Profiled_Phase::NUM_PHASES)>
+        statistics;
+    std::lock_guard<std::mutex> lock(Profiler::records_mutex);
+
+    for (const auto & record : Profiler::records) {
+        std::lock_guard<std::mutex> record_lock(record->mutex);
+
+        for (unsigned phase = 0; phase < statistics.size(); phase++) {
+            statistics[phase].time += record->statistics[phase].time;
+            statistics[phase].num_intervals +=
+                record->statistics[phase].num_intervals;
+        }
+    }
+
+    return statistics;
+}
+
+void Profiler::write_statistics(std::ostream & os) {
+    const auto statistics = Profiler::statistics();
+
+    for (unsigned phase = 0; phase < statistics.size(); phase++) {
+        if (statistics[phase].num_intervals == 0) {
+            continue;
+        }
+
+        os << "Time in " << to_string(Profiled_Phase(phase)) << ": "
+           << std::chrono::duration<double>(statistics[phase].time).count()
+           << std::endl
+           << "Number of intervals in " << to_string(Profiled_Phase(phase))
+           << ": " << statistics[phase].num_intervals << std::endl;
+    }
+}
+
+void Profiler::write_trace(std::ostream & os) {
+    std::lock_guard<std::mutex> lock(Profiler::records_mutex);
+    const auto precision = os.precision();
+    bool first = true;
+
+    // Complete ("X") events, with timestamps in microseconds
+    os << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+
+    for (const auto & record : Profiler::records) {
+        std::lock_guard<std::mutex> record_lock(record->mutex);
+
+        for (const Event & event : record->events) {
+            os << (first ? "" : ",") << std::endl
+               << "{\"name\":\"" << to_string(event.phase)
+               << "\",\"cat\":\"solver\",\"ph\":\"X\",\"ts\":"
+               << event.start / 1e3 << ",\"dur\":" << event.duration / 1e3
+               << ",\"pid\":0,\"tid\":" << record->thread << "}";
+            first = false;
+        }
+    }
+
+    os << std::endl << "],\"displayTimeUnit\":\"ms\"}" << std::endl;
+    os.unsetf(std::ios_base::floatfield);
+    os.precision(precision);
+}
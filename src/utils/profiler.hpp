@@ -0,0 +1,214 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+/****************************************************************
+ * The phases of a solve whose time is measured by the profiler.
+ ****************************************************************/
+enum class Profiled_Phase : unsigned {
+    DECODE,
+    ARCHIVE_UPDATE,
+    SNAPSHOT,
+    EVOLVE,
+    EXCHANGE_ELITE,
+    PATH_RELINK,
+    SHAKE,
+    RESET,
+    LOCAL_SEARCH,
+    MATERIALIZATION,
+    NUM_PHASES
+};
+
+/***************************************
+ * Returns the name of a profiled phase.
+ *
+ * @param phase the phase.
+ *
+ * @return the name of the phase.
+ ***************************************/
+const char * to_string(Profiled_Phase phase);
+
+/*********************************************************************
+ * The Profiler class accumulates the time spent in each phase of the
+ * solves of the process, by every thread, and records each measured
+ * interval as a trace event. Each thread accumulates in its own
+ * record, so measuring does not contend with other threads.
+ *
+ * The phases are measured only if the sources are compiled with
+ * MOFJSSP_PROFILE defined (e.g., make CARGS="... -DMOFJSSP_PROFILE");
+ * otherwise MOFJSSP_PROFILE_SCOPE expands to nothing and the profiler
+ * reports no time.
+ *********************************************************************/
+class Profiler {
+    public:
+    /*************************************************
+     * The total time and number of intervals of a
+     * phase.
+     *************************************************/
+    struct Phase_Statistics {
+        std::chrono::nanoseconds time{0};
+
+        unsigned long long num_intervals = 0;
+    };
+
+    /*****************************************************************
+     * The maximum number of trace events recorded by each thread;
+     * later intervals are still accumulated, but not traced.
+     *****************************************************************/
+    static constexpr std::size_t max_num_events_of_thread = 1 << 20;
+
+    private:
+    /**************************************************
+     * An interval of a phase, in nanoseconds since
+     * the start of the process.
+     **************************************************/
+    struct Event {
+        Profiled_Phase phase;
+
+        std::int64_t start;
+
+        std::int64_t duration;
+    };
+
+    /*********************************************
+     * The measures of a thread, which survive it.
+     *********************************************/
+    struct Thread_Record {
+        std::mutex mutex;
+
+        unsigned thread;
+
+        std::array<Phase_Statistics,
+                   unsigned(Profiled_Phase::NUM_PHASES)> statistics;
+
+        std::vector<Event> events;
+    };
+
+    /*******************************************
+     * The records of every thread, in the
+     * order the threads started measuring.
+     *******************************************/
+    static std::mutex records_mutex;
+
+    static std::vector<std::shared_ptr<Thread_Record>> records;
+
+    /******************************
+     * The start of the process.
+     ******************************/
+    static const std::chrono::steady_clock::time_point epoch;
+
+    /*************************************
+     * Returns the record of this thread.
+     *************************************/
+    static Thread_Record & record_of_thread();
+
+    public:
+    /****************************************************************
+     * Returns whether the phases are measured, i.e., whether the
+     * sources were compiled with MOFJSSP_PROFILE defined.
+     *
+     * @return true if the phases are measured; false otherwise.
+     ****************************************************************/
+    static constexpr bool enabled() {
+#ifdef MOFJSSP_PROFILE
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /*****************************************************
+     * Records an interval of a phase spent by this thread.
+     *
+     * @param phase the phase.
+     * @param start the start of the interval.
+     * @param end   the end of the interval.
+     *****************************************************/
+    static void record(Profiled_Phase phase,
+                       const std::chrono::steady_clock::time_point & start,
+                       const std::chrono::steady_clock::time_point & end);
+
+    /****************************************************************
+     * Discards every interval recorded so far, by any thread.
+     ****************************************************************/
+    static void reset();
+
+    /****************************************************************
+     * Returns the total time and number of intervals of each phase,
+     * summed over the threads.
+     *
+     * @return the statistics of each phase.
+     ****************************************************************/
+    static std::array<Phase_Statistics, unsigned(Profiled_Phase::NUM_PHASES)>
+        statistics();
+
+    /*****************************************************************
+     * Writes the time, in seconds, and number of intervals of each
+     * phase measured, one line per phase. A phase that encloses
+     * another (e.g., evolving, which decodes) includes its time.
+     *
+     * @param os the output stream.
+     *****************************************************************/
+    static void write_statistics(std::ostream & os);
+
+    /*****************************************************************
+     * Writes the intervals recorded as a Chrome trace-event JSON
+     * document, which chrome://tracing or Perfetto display as one
+     * timeline per thread.
+     *
+     * @param os the output stream.
+     *****************************************************************/
+    static void write_trace(std::ostream & os);
+};
+
+/*****************************************************************
+ * The Scoped_Timer class records the interval between its
+ * construction and its destruction as spent in a phase.
+ *****************************************************************/
+class Scoped_Timer {
+    private:
+    /***********************
+     * The phase measured.
+     ***********************/
+    Profiled_Phase phase;
+
+    /*****************************
+     * The start of the interval.
+     *****************************/
+    std::chrono::steady_clock::time_point start;
+
+    public:
+    explicit Scoped_Timer(Profiled_Phase phase)
+        : phase(phase), start(std::chrono::steady_clock::now()) {}
+
+    Scoped_Timer(const Scoped_Timer & timer) = delete;
+
+    Scoped_Timer & operator = (const Scoped_Timer & timer) = delete;
+
+    ~Scoped_Timer() {
+        Profiler::record(this->phase,
+                         this->start,
+                         std::chrono::steady_clock::now());
+    }
+};
+
+#define MOFJSSP_PROFILE_CONCAT_(a, b) a##b
+#define MOFJSSP_PROFILE_CONCAT(a, b) MOFJSSP_PROFILE_CONCAT_(a, b)
+
+/*****************************************************************
+ * Measures the rest of the enclosing scope as spent in a phase,
+ * or does nothing if MOFJSSP_PROFILE is not defined.
+ *****************************************************************/
+#ifdef MOFJSSP_PROFILE
+#define MOFJSSP_PROFILE_SCOPE(phase) \
+    const Scoped_Timer MOFJSSP_PROFILE_CONCAT(scoped_timer_, __LINE__)( \
+            Profiled_Phase::phase)
+#else
+#define MOFJSSP_PROFILE_SCOPE(phase) static_cast<void>(0)
+#endif
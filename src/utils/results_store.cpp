@@ -0,0 +1,263 @@
+#include "utils/results_store.hpp"
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+#if __has_include(<fcntl.h>) && __has_include(<sys/file.h>) && \
+    __has_include(<unistd.h>)
+#   define RESULTS_STORE_LOCKING_AVAILABLE
+#   include <fcntl.h>
+#   include <sys/file.h>
+#   include <unistd.h>
+#endif
+
+static const char * header = "instance,solver,seed,snapshot,iteration,time,"
+                             "num_jobs,num_machines,num_operations,"
+                             "num_objectives,hypervolume,igd_plus,"
+                             "multiplicative_epsilon";
+
+static const unsigned num_columns = 13;
+
+std::string Results_Store::key(const Row & row) {
+    return row.instance + "," + row.solver + "," + std::to_string(row.seed) +
+           "," + std::to_string(row.snapshot);
+}
+
+std::string Results_Store::name(Metric metric) {
+    switch (metric) {
+        case HYPERVOLUME:
+            return "hypervolume";
+        case IGD_PLUS:
+            return "igd_plus";
+        case MULTIPLICATIVE_EPSILON:
+            return "multiplicative_epsilon";
+        default:
+            return "";
+    }
+}
+
+bool Results_Store::is_maximized(Metric metric) {
+    return metric != IGD_PLUS;
+}
+
+std::vector<Results_Store::Row> Results_Store::run_rows(
+        const Row & run,
+        Metric metric,
+        double value,
+        const std::vector<unsigned> & iterations,
+        const std::vector<double> & times,
+        const std::vector<double> & values) {
+    std::vector<Row> rows(values.size() + 1, run);
+
+    for (Row & row : rows) {
+        row.metrics.fill(std::numeric_limits<double>::quiet_NaN());
+    }
+
+    rows[0].snapshot = FINAL_SNAPSHOT;
+    rows[0].iteration = 0;
+    rows[0].time = 0.0;
+    rows[0].metrics[metric] = value;
+
+    for (unsigned j = 0; j < values.size(); j++) {
+        rows[j + 1].snapshot = j;
+        rows[j + 1].iteration = iterations[j];
+        rows[j + 1].time = times[j];
+        rows[j + 1].metrics[metric] = values[j];
+    }
+
+    return rows;
+}
+
+void Results_Store::append(const std::string & filename,
+                           const std::vector<Row> & rows) {
+    std::ostringstream oss;
+
+    oss.precision(std::numeric_limits<double>::max_digits10);
+
+    for (const Row & row : rows) {
+        oss << row.instance << "," << row.solver << "," << row.seed << ","
+            << row.snapshot << "," << row.iteration << "," << row.time << ","
+            << row.num_jobs << "," << row.num_machines << ","
+            << row.num_operations << "," << row.num_objectives;
+
+        for (double value : row.metrics) {
+            oss << ",";
+
+            if (std::isnan(value)) {
+                oss << "NA";
+            } else {
+                oss << value;
+            }
+        }
+
+        oss << "\n";
+    }
+
+#   ifdef RESULTS_STORE_LOCKING_AVAILABLE
+    const int file_descriptor = open(filename.c_str(),
+                                     O_WRONLY | O_CREAT | O_APPEND, 0644);
+
+    if (file_descriptor < 0) {
+        throw std::runtime_error("File " + filename + " not created.");
+    }
+
+    flock(file_descriptor, LOCK_EX);
+
+    // The header is only written by the first writer
+    const std::string text =
+        (lseek(file_descriptor, 0, SEEK_END) == 0 ?
+             std::string(header) + "\n" : std::string()) + oss.str();
+    std::size_t num_written = 0;
+
+    while (num_written < text.size()) {
+        const ssize_t result = write(file_descriptor,
+                                     text.data() + num_written,
+                                     text.size() - num_written);
+
+        if (result < 0) {
+            flock(file_descriptor, LOCK_UN);
+            close(file_descriptor);
+            throw std::runtime_error("Error writing file " + filename + ".");
+        }
+
+        num_written += result;
+    }
+
+    flock(file_descriptor, LOCK_UN);
+    close(file_descriptor);
+#   else
+    std::ofstream ofs;
+    ofs.open(filename, std::ios::app);
+
+    if (!ofs.is_open()) {
+        throw std::runtime_error("File " + filename + " not created.");
+    }
+
+    ofs.seekp(0, std::ios::end);
+
+    if (ofs.tellp() == 0) {
+        ofs << header << "\n";
+    }
+
+    ofs << oss.str();
+
+    if (ofs.eof() || ofs.fail() || ofs.bad()) {
+        throw std::runtime_error("Error writing file " + filename + ".");
+    }
+
+    ofs.close();
+#   endif
+}
+
+Results_Store Results_Store::load(const std::string & filename) {
+    Results_Store store;
+    std::ifstream ifs;
+
+    ifs.open(filename);
+
+    if (!ifs.is_open()) {
+        throw std::runtime_error("File " + filename + " not found.");
+    }
+
+    std::string line;
+
+    // The header
+    std::getline(ifs, line);
+
+    while (std::getline(ifs, line)) {
+        if (line.empty()) {
+            continue;
+        }
+
+        std::vector<std::string> fields;
+        std::istringstream iss(line);
+
+        for (std::string field; std::getline(iss, field, ',');) {
+            fields.push_back(field);
+        }
+
+        if (fields.size() != num_columns) {
+            throw std::runtime_error("Error reading file " + filename + ".");
+        }
+
+        Row row;
+
+        try {
+            row.instance = fields[0];
+            row.solver = fields[1];
+            row.seed = std::stoul(fields[2]);
+            row.snapshot = std::stoi(fields[3]);
+            row.iteration = std::stoul(fields[4]);
+            row.time = std::stod(fields[5]);
+            row.num_jobs = std::stoul(fields[6]);
+            row.num_machines = std::stoul(fields[7]);
+            row.num_operations = std::stoul(fields[8]);
+            row.num_objectives = std::stoul(fields[9]);
+
+            for (unsigned metric = 0; metric < NUM_METRICS; metric++) {
+                row.metrics[metric] = fields[10 + metric] == "NA" ?
+                    std::numeric_limits<double>::quiet_NaN() :
+                    std::stod(fields[10 + metric]);
+            }
+        } catch (const std::logic_error &) {
+            throw std::runtime_error("Error reading file " + filename + ".");
+        }
+
+        store.push_back(row);
+    }
+
+    ifs.close();
+
+    return store;
+}
+
+std::size_t Results_Store::size() const {
+    return this->instances.size();
+}
+
+void Results_Store::push_back(const Row & row) {
+    const auto result = this->row_indices.emplace(Results_Store::key(row),
+                                                  this->size());
+
+    if (!result.second) {
+        const std::size_t i = result.first->second;
+
+        for (unsigned metric = 0; metric < NUM_METRICS; metric++) {
+            if (!std::isnan(row.metrics[metric])) {
+                this->metrics[metric][i] = row.metrics[metric];
+            }
+        }
+
+        return;
+    }
+
+    this->instances.push_back(row.instance);
+    this->solvers.push_back(row.solver);
+    this->seeds.push_back(row.seed);
+    this->snapshots.push_back(row.snapshot);
+    this->iterations.push_back(row.iteration);
+    this->times.push_back(row.time);
+    this->num_jobs.push_back(row.num_jobs);
+    this->num_machines.push_back(row.num_machines);
+    this->num_operations.push_back(row.num_operations);
+    this->num_objectives.push_back(row.num_objectives);
+
+    for (unsigned metric = 0; metric < NUM_METRICS; metric++) {
+        this->metrics[metric].push_back(row.metrics[metric]);
+    }
+}
+
+Results_Store::Row Results_Store::row(std::size_t i) const {
+    Row row{this->instances[i], this->solvers[i], this->seeds[i],
+            this->snapshots[i], this->iterations[i], this->times[i],
+            this->num_jobs[i], this->num_machines[i], this->num_operations[i],
+            this->num_objectives[i], {}};
+
+    for (unsigned metric = 0; metric < NUM_METRICS; metric++) {
+        row.metrics[metric] = this->metrics[metric][i];
+    }
+
+    return row;
+}
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*********************************************************************
+ * The Results_Store class holds the metrics of the runs of an
+ * experiment, one row per instance, solver, seed and snapshot (the
+ * final front of a run being its snapshot -1), column by column. It
+ * is kept in a CSV file with a header, to which the calculators
+ * append the rows of the metrics they compute, the others being NA;
+ * the rows of the same run and snapshot are merged when it is loaded.
+ *********************************************************************/
+class Results_Store {
+    public:
+    /*****************************************************************
+     * The metrics, the multiplicative epsilon being stored inverted,
+     * as by its calculator.
+     *****************************************************************/
+    enum Metric : unsigned {
+        HYPERVOLUME,
+        IGD_PLUS,
+        MULTIPLICATIVE_EPSILON,
+        NUM_METRICS
+    };
+
+    /*********************************************
+     * The snapshot of the final front of a run.
+     *********************************************/
+    static constexpr int FINAL_SNAPSHOT = -1;
+
+    /*****************************************************************
+     * A row, with the characteristics of the instance by which the
+     * results are grouped, and NaN for the metrics not computed. The
+     * iteration and time of the final front are 0.
+     *****************************************************************/
+    struct Row {
+        std::string instance;
+        std::string solver;
+        unsigned seed;
+        int snapshot;
+        unsigned iteration;
+        double time;
+        unsigned num_jobs;
+        unsigned num_machines;
+        unsigned num_operations;
+        unsigned num_objectives;
+        std::array<double, NUM_METRICS> metrics;
+    };
+
+    /*********************************
+     * The columns.
+     *********************************/
+    std::vector<std::string> instances;
+    std::vector<std::string> solvers;
+    std::vector<unsigned> seeds;
+    std::vector<int> snapshots;
+    std::vector<unsigned> iterations;
+    std::vector<double> times;
+    std::vector<unsigned> num_jobs;
+    std::vector<unsigned> num_machines;
+    std::vector<unsigned> num_operations;
+    std::vector<unsigned> num_objectives;
+    std::array<std::vector<double>, NUM_METRICS> metrics;
+
+    private:
+    /*****************************************************************
+     * The index of the row of each instance, solver, seed and
+     * snapshot.
+     *****************************************************************/
+    std::unordered_map<std::string, std::size_t> row_indices;
+
+    /*****************************************************
+     * Returns the key of the row of a run and snapshot.
+     *****************************************************/
+    static std::string key(const Row & row);
+
+    public:
+    /*******************************************
+     * Returns the name of a metric.
+     *
+     * @param metric the metric.
+     *
+     * @return the name of the metric.
+     *******************************************/
+    static std::string name(Metric metric);
+
+    /*****************************************************
+     * Verifies whether the greater a metric the better.
+     *
+     * @param metric the metric.
+     *
+     * @return true if the metric is maximized.
+     *****************************************************/
+    static bool is_maximized(Metric metric);
+
+    /*****************************************************************
+     * Returns the rows of the final front and of the snapshots of a
+     * run, with the values of a metric.
+     *
+     * @param run        the row of the run, whose snapshot, iteration,
+     *                   time and metrics are replaced.
+     * @param metric     the metric.
+     * @param value      the value of the metric on the final front.
+     * @param iterations the iteration of each snapshot.
+     * @param times      the time of each snapshot.
+     * @param values     the value of the metric on each snapshot.
+     *
+     * @return the rows of the run.
+     *****************************************************************/
+    static std::vector<Row> run_rows(const Row & run,
+                                     Metric metric,
+                                     double value,
+                                     const std::vector<unsigned> & iterations,
+                                     const std::vector<double> & times,
+                                     const std::vector<double> & values);
+
+    /*****************************************************************
+     * Appends rows to a store file, creating it with its header if it
+     * does not exist. The file is locked while the rows are appended,
+     * so that calculators running in parallel can share it.
+     *
+     * @param filename the name of the store file.
+     * @param rows     the rows.
+     *
+     * @throw std::runtime_error if the file cannot be written.
+     *****************************************************************/
+    static void append(const std::string & filename,
+                       const std::vector<Row> & rows);
+
+    /*****************************************************************
+     * Loads a store file.
+     *
+     * @param filename the name of the store file.
+     *
+     * @return the store.
+     *
+     * @throw std::runtime_error if the file cannot be read.
+     *****************************************************************/
+    static Results_Store load(const std::string & filename);
+
+    /*********************************
+     * Returns the number of rows.
+     *
+     * @return the number of rows.
+     *********************************/
+    std::size_t size() const;
+
+    /*****************************************************************
+     * Adds a row, or merges it into the row of the same run and
+     * snapshot, whose metrics are replaced by those computed.
+     *
+     * @param row the row.
+     *****************************************************************/
+    void push_back(const Row & row);
+
+    /*****************************************
+     * Returns a row.
+     *
+     * @param i the index of the row.
+     *
+     * @return the row.
+     *****************************************/
+    Row row(std::size_t i) const;
+};
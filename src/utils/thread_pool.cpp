@@ -0,0 +1,123 @@
+#include "utils/thread_pool.hpp"
+#include <algorithm>
+
+Thread_Pool::Thread_Pool(unsigned num_threads)
+    : queues(std::max(1u, num_threads)),
+      num_threads(std::max(1u, num_threads)) {
+    for (unsigned i = 0; i < this->num_threads; i++) {
+        this->workers.emplace_back(&Thread_Pool::work, this, i);
+    }
+}
+
+Thread_Pool::~Thread_Pool() {
+    {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->tasks_finished.wait(lock, [this]() {
+            return this->num_unfinished_tasks == 0;
+        });
+        this->stopping = true;
+    }
+
+    this->task_available.notify_all();
+
+    for (std::thread & worker : this->workers) {
+        worker.join();
+    }
+}
+
+bool Thread_Pool::take(std::size_t worker, Task & task) {
+    const auto fits = [this](const Task & task) {
+        return this->num_busy_threads == 0 ||
+               this->num_busy_threads + task.num_threads <= this->num_threads;
+    };
+
+    // The oldest task of the worker's own queue
+    std::deque<Task> & own_queue = this->queues[worker];
+
+    if (!own_queue.empty() && fits(own_queue.front())) {
+        task = std::move(own_queue.front());
+        own_queue.pop_front();
+        return true;
+    }
+
+    // The most recent task of another worker's queue
+    for (std::size_t i = 1; i < this->queues.size(); i++) {
+        std::deque<Task> & queue =
+            this->queues[(worker + i) % this->queues.size()];
+
+        if (!queue.empty() && fits(queue.back())) {
+            task = std::move(queue.back());
+            queue.pop_back();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void Thread_Pool::work(std::size_t worker) {
+    for (;;) {
+        Task task;
+
+        {
+            // Only woken when a task is submitted or finished, so a worker
+            // that finds no task fitting in the free threads sleeps
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->task_available.wait(lock, [this, worker, &task]() {
+                return this->stopping || this->take(worker, task);
+            });
+
+            if (this->stopping) {
+                return;
+            }
+
+            this->num_busy_threads += task.num_threads;
+        }
+
+        try {
+            task.function();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(this->mutex);
+
+            if (!this->exception) {
+                this->exception = std::current_exception();
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->num_busy_threads -= task.num_threads;
+            this->num_unfinished_tasks--;
+        }
+
+        // The threads freed may fit a task that did not fit before
+        this->task_available.notify_all();
+        this->tasks_finished.notify_all();
+    }
+}
+
+void Thread_Pool::submit(std::function<void()> task, unsigned num_threads) {
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        this->queues[this->next_queue].push_back(
+                Task{std::move(task), std::max(1u, num_threads)});
+        this->next_queue = (this->next_queue + 1) % this->queues.size();
+        this->num_unfinished_tasks++;
+    }
+
+    this->task_available.notify_one();
+}
+
+void Thread_Pool::wait() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->tasks_finished.wait(lock, [this]() {
+        return this->num_unfinished_tasks == 0;
+    });
+
+    if (this->exception) {
+        std::exception_ptr exception = this->exception;
+        this->exception = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/****************************************************************
+ * The Thread_Pool class represents a work-stealing thread pool.
+ * Each worker has its own queue of tasks; an idle worker takes
+ * the oldest task of its queue or, if its queue is empty,
+ * steals the most recent task of another worker's queue, so
+ * the tasks submitted first are started first.
+ * A task may run several threads of its own, which are charged
+ * against the threads of the pool: a task is only started if
+ * its threads fit in those not used by the running tasks, or
+ * if no task is running.
+ ****************************************************************/
+class Thread_Pool {
+    private:
+    /*******************************************
+     * A task and the number of its threads.
+     *******************************************/
+    struct Task {
+        std::function<void()> function;
+        unsigned num_threads;
+    };
+
+    /**************************************
+     * The queue of tasks of each worker.
+     **************************************/
+    std::vector<std::deque<Task>> queues;
+
+    /*****************
+     * The workers.
+     *****************/
+    std::vector<std::thread> workers;
+
+    /***************************************************
+     * Guards the queues, the counters and the stop flag.
+     ***************************************************/
+    std::mutex mutex;
+
+    /****************************************************
+     * Notified when a task is submitted or on stopping.
+     ****************************************************/
+    std::condition_variable task_available;
+
+    /****************************************
+     * Notified when all tasks are finished.
+     ****************************************/
+    std::condition_variable tasks_finished;
+
+    /*****************************************************
+     * The number of threads of the pool, and of those used
+     * by the running tasks.
+     *****************************************************/
+    const unsigned num_threads;
+
+    unsigned num_busy_threads = 0;
+
+    /*****************************************************
+     * The number of submitted tasks not yet finished.
+     *****************************************************/
+    std::size_t num_unfinished_tasks = 0;
+
+    /*************************************************
+     * The queue to which the next task is submitted.
+     *************************************************/
+    std::size_t next_queue = 0;
+
+    /**********************************
+     * Whether the workers must stop.
+     **********************************/
+    bool stopping = false;
+
+    /*******************************************
+     * The first exception thrown by a task.
+     *******************************************/
+    std::exception_ptr exception = nullptr;
+
+    /*****************************************************************
+     * Takes a task that fits in the free threads for the specified
+     * worker, stealing one if needed. The mutex must be held.
+     *
+     * @param worker the worker.
+     * @param task   the task taken.
+     *
+     * @return true if a task was taken; false otherwise.
+     *****************************************************************/
+    bool take(std::size_t worker, Task & task);
+
+    /******************************************
+     * The loop executed by each worker.
+     *
+     * @param worker the worker.
+     ******************************************/
+    void work(std::size_t worker);
+
+    public:
+    /****************************************************
+     * Constructs a new thread pool.
+     *
+     * @param num_threads the number of worker threads.
+     ****************************************************/
+    Thread_Pool(unsigned num_threads);
+
+    /*****************************************************
+     * Waits for the tasks and stops the worker threads.
+     *****************************************************/
+    ~Thread_Pool();
+
+    /***************************************************************
+     * Submits a task.
+     *
+     * @param task        the task to be executed.
+     * @param num_threads the number of threads run by the task.
+     ***************************************************************/
+    void submit(std::function<void()> task, unsigned num_threads = 1);
+
+    /***************************************************************
+     * Waits until all submitted tasks are finished, rethrowing the
+     * first exception thrown by a task, if any.
+     ***************************************************************/
+    void wait();
+};